@@ -0,0 +1,81 @@
+//
+// Full match list against a sparse fieldset (?fields=id,score) for large tournaments: bytes the database
+// sends, then decode and encode time for what the service does with them. The projected documents are what
+// "document - $2::text[]" returns.
+//
+
+#include <chrono>
+#include <cstddef>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Fields.hpp"
+#include "domain/Match.hpp"
+#include "domain/Utilities.hpp"
+#include "serialization/DocumentDecoder.hpp"
+#include "serialization/Encoding.hpp"
+#include "serialization/FieldSet.hpp"
+
+namespace {
+    using MatchFields = serialization::FieldSet<domain::Match>;
+
+    // Stored documents as the MATCHES table holds them, the id being a column of its own.
+    std::vector<std::string> StoredDocuments(std::size_t count, const MatchFields& fields) {
+        std::vector<std::string> documents;
+        documents.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            nlohmann::json document = {
+                {"name", "W" + std::to_string(i)},
+                {"tournamentId", "550e8400-e29b-41d4-a716-446655440000"},
+                {"homeTeamId", "6ba7b810-9dad-11d1-80b4-00c04fd4" + std::to_string(1000 + i % 9000)},
+                {"visitorTeamId", "6ba7b811-9dad-11d1-80b4-00c04fd4" + std::to_string(1000 + (i + 1) % 9000)},
+                {"score", {{"homeTeamScore", static_cast<int>(i % 5)}, {"visitorTeamScore", static_cast<int>(i % 3)}}},
+            };
+            for (auto it = document.begin(); it != document.end();) {
+                it = fields.Contains(it.key()) ? std::next(it) : document.erase(it);
+            }
+            documents.push_back(document.dump());
+        }
+        return documents;
+    }
+
+    void Run(std::string_view label, std::size_t count, const MatchFields& fields, std::size_t iterations) {
+        const auto documents = StoredDocuments(count, fields);
+        std::size_t fetched = 0;
+        for (const auto& document : documents) {
+            fetched += document.size() + 36;
+        }
+
+        std::size_t encoded = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            std::vector<domain::Match> matches;
+            matches.reserve(documents.size());
+            for (const auto& document : documents) {
+                auto& match = matches.emplace_back(serialization::ParseDocument<domain::Match>(document));
+                if (fields.Contains("id")) {
+                    match.Id() = "660e8400-e29b-41d4-a716-446655440001";
+                }
+            }
+            std::string out;
+            serialization::Encode(out, serialization::Encoding::MSGPACK, matches, 192, fields);
+            encoded = out.size();
+        }
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::println("{:<10} {:>7} matches  fetched {:>10} B  response {:>10} B  {:>9.2f} ms/list",
+                     label, count, fetched, encoded, elapsed / static_cast<double>(iterations));
+    }
+}
+
+int main() {
+    const auto sparse = MatchFields::Parse("id,score");
+    for (std::size_t count : {1000, 10000, 100000}) {
+        const std::size_t iterations = count >= 100000 ? 3 : 30;
+        Run("full", count, MatchFields::All(), iterations);
+        Run("id,score", count, *sparse, iterations);
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+//
+// Compares the former std::regex based ID_VALUE check against domain::IsValidId.
+//
+
+#include <chrono>
+#include <cstddef>
+#include <print>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "domain/Uuid.hpp"
+
+namespace {
+    const std::regex ID_VALUE(R"(^[0-9a-fA-F]{8}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{12}$)");
+
+    template<typename Validator>
+    void Run(const std::string_view& label, const std::vector<std::string>& ids, std::size_t iterations, Validator validator) {
+        std::size_t valid = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            for (const auto& id : ids) {
+                valid += validator(id) ? 1 : 0;
+            }
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::println("{:<12} {:>10.2f} ns/id  (valid={})", label, elapsed / static_cast<double>(iterations * ids.size()), valid);
+    }
+}
+
+int main() {
+    const std::vector<std::string> ids = {
+        "550e8400-e29b-41d4-a716-446655440000",
+        "6ba7b810-9dad-11d1-80b4-00c04fd430c8",
+        "6BA7B811-9DAD-11D1-80B4-00C04FD430C8",
+        "not-a-valid-identifier",
+        "550e8400-e29b-41d4-a716-44665544000g",
+    };
+    constexpr std::size_t iterations = 200000;
+
+    Run("std::regex", ids, iterations / 20, [](const std::string& id) { return std::regex_match(id, ID_VALUE); });
+    Run("scalar", ids, iterations, [](const std::string& id) { return domain::uuid::IsValidScalar(id); });
+    Run("IsValidId", ids, iterations, [](const std::string& id) { return domain::IsValidId(id); });
+    return 0;
+}
@@ -52,10 +52,42 @@ CREATE TABLE MATCHES (
     id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
     TOURNAMENT_ID UUID not null references TOURNAMENTS(ID),
     document JSONB NOT NULL,
+    revision BIGINT NOT NULL DEFAULT 0,
     last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 
+-- Match list validator (version_matches_by_tournament): every update moves its row's revision, so the sum
+-- changes even when concurrent writes commit out of order and leave max(last_update_date) where it was.
+CREATE FUNCTION bump_match_revision() RETURNS trigger AS $$
+BEGIN
+    NEW.revision := OLD.revision + 1;
+    RETURN NEW;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE TRIGGER matches_bump_revision
+    BEFORE UPDATE ON MATCHES
+    FOR EACH ROW EXECUTE FUNCTION bump_match_revision();
+
+-- Live updates (GET /tournaments/{id}/events): every committed match write is announced on match_changes,
+-- with the document in the same shape the match list returns.
+CREATE FUNCTION notify_match_change() RETURNS trigger AS $$
+BEGIN
+    IF TG_OP = 'UPDATE' AND OLD.document IS NOT DISTINCT FROM NEW.document THEN
+        RETURN NEW;
+    END IF;
+    PERFORM pg_notify('match_changes', jsonb_build_object(
+        'tournamentId', NEW.tournament_id,
+        'match', NEW.document || jsonb_build_object('id', NEW.id))::text);
+    RETURN NEW;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE TRIGGER matches_notify_change
+    AFTER INSERT OR UPDATE ON MATCHES
+    FOR EACH ROW EXECUTE FUNCTION notify_match_change();
+
 GRANT SELECT ON ALL TABLES IN SCHEMA public TO tournament_svc;
 GRANT DELETE ON ALL TABLES IN SCHEMA public TO tournament_svc;
 GRANT UPDATE ON ALL TABLES IN SCHEMA public TO tournament_svc;
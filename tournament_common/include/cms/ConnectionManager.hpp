@@ -7,6 +7,7 @@
 
 #include <cms/Connection.h>
 #include <cms/Session.h>
+#include <activemq/core/ActiveMQConnection.h>
 #include <activemq/core/ActiveMQConnectionFactory.h>
 #include <memory>
 
@@ -21,6 +22,21 @@ public:
 
     [[nodiscard]] std::shared_ptr<cms::Connection> Connection() const { return connection; }
 
+    // With a failover:// broker URL the connection stays open while the transport reconnects, so this asks
+    // the transport itself.
+    [[nodiscard]] bool IsConnected() const {
+        const auto* amqConnection = dynamic_cast<activemq::core::ActiveMQConnection*>(connection.get());
+        return amqConnection != nullptr && !amqConnection->isClosed() && !amqConnection->isTransportFailed()
+            && amqConnection->getTransport().isConnected();
+    }
+
+    // Before ActiveMQCPP::shutdownLibrary(); sends already returned were acknowledged by the broker.
+    void Close() {
+        if (connection) {
+            connection->close();
+        }
+    }
+
     [[nodiscard]] std::shared_ptr<cms::Session> CreateSession() const {
         return std::shared_ptr<cms::Session>(connection->createSession(cms::Session::AUTO_ACKNOWLEDGE));
     }
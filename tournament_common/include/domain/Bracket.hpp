@@ -0,0 +1,90 @@
+#ifndef DOMAIN_BRACKET_HPP
+#define DOMAIN_BRACKET_HPP
+
+#include <array>
+#include <charconv>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Read model behind GET /tournaments/{id}/bracket: the matches of a tournament arranged by section and
+// round, each side with its team already resolved.
+namespace domain {
+    // Team fields stay empty until the bracket has advanced a team into the match.
+    struct BracketSlot {
+        std::string teamId;
+        std::string teamName;
+        std::string groupName;
+        int score = 0;
+    };
+
+    struct BracketMatch {
+        std::string id;
+        std::string name;
+        BracketSlot home;
+        BracketSlot visitor;
+    };
+
+    struct BracketRound {
+        int number = 0;
+        std::vector<BracketMatch> matches;
+    };
+
+    struct Bracket {
+        std::string tournamentId;
+        std::vector<BracketRound> winners;
+        std::vector<BracketRound> losers;
+        std::vector<BracketRound> finals;
+    };
+
+    enum class BracketSection { WINNERS, LOSERS, FINALS };
+
+    struct BracketPosition {
+        BracketSection section;
+        // zero based
+        std::size_t round;
+    };
+
+    // Round boundaries of the names BracketGenerator assigns (W0-W30, L0-L29, F0-F1): round r holds the
+    // match numbers from entry r up to entry r + 1.
+    constexpr std::array WINNERS_ROUND_STARTS{0, 16, 24, 28, 30, 31};
+    constexpr std::array LOSERS_ROUND_STARTS{0, 8, 16, 20, 24, 26, 28, 29, 30};
+    constexpr std::array FINALS_ROUND_STARTS{0, 1, 2};
+
+    template<std::size_t N>
+    constexpr std::optional<std::size_t> RoundOf(const std::array<int, N>& starts, int number) {
+        for (std::size_t round = 0; round + 1 < N; ++round) {
+            if (number >= starts[round] && number < starts[round + 1]) {
+                return round;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // nullopt for names outside the scheme
+    constexpr std::optional<BracketPosition> ParseBracketPosition(std::string_view name) {
+        if (name.size() < 2) {
+            return std::nullopt;
+        }
+        int number = 0;
+        const auto [end, error] = std::from_chars(name.data() + 1, name.data() + name.size(), number);
+        if (error != std::errc{} || end != name.data() + name.size()) {
+            return std::nullopt;
+        }
+        std::optional<std::size_t> round;
+        BracketSection section;
+        switch (name.front()) {
+            case 'W': section = BracketSection::WINNERS; round = RoundOf(WINNERS_ROUND_STARTS, number); break;
+            case 'L': section = BracketSection::LOSERS; round = RoundOf(LOSERS_ROUND_STARTS, number); break;
+            case 'F': section = BracketSection::FINALS; round = RoundOf(FINALS_ROUND_STARTS, number); break;
+            default: return std::nullopt;
+        }
+        if (!round) {
+            return std::nullopt;
+        }
+        return BracketPosition{section, *round};
+    }
+}
+
+#endif //DOMAIN_BRACKET_HPP
@@ -0,0 +1,121 @@
+#ifndef DOMAIN_FIELDS_HPP
+#define DOMAIN_FIELDS_HPP
+
+#include <tuple>
+
+#include "serialization/FieldTable.hpp"
+#include "domain/Bracket.hpp"
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+
+// JSON shape of every domain type, keys in ascending order.
+namespace serialization {
+    template<>
+    struct FieldTable<domain::Team> {
+        static constexpr auto fields = std::tuple{
+            Field{"id", [](auto& team) -> auto& { return team.Id; }},
+            Field{"name", [](auto& team) -> auto& { return team.Name; }, Output::ALWAYS, Input::REQUIRED},
+        };
+    };
+    static_assert(KeysSorted<domain::Team>());
+
+    template<>
+    struct FieldTable<domain::Score> {
+        static constexpr auto fields = std::tuple{
+            Field{"homeTeamScore", [](auto& score) -> auto& { return score.homeTeamScore; }},
+            Field{"visitorTeamScore", [](auto& score) -> auto& { return score.visitorTeamScore; }},
+        };
+    };
+    static_assert(KeysSorted<domain::Score>());
+
+    template<>
+    struct FieldTable<domain::Match> {
+        static constexpr auto fields = std::tuple{
+            Field{"homeTeamId", [](auto& match) -> auto& { return match.HomeTeamId(); }, Output::IF_NOT_EMPTY},
+            Field{"id", [](auto& match) -> auto& { return match.Id(); }, Output::IF_NOT_EMPTY},
+            Field{"name", [](auto& match) -> auto& { return match.Name(); }, Output::IF_NOT_EMPTY},
+            Field{"score", [](auto& match) -> auto& { return match.MatchScore(); }},
+            Field{"tournamentId", [](auto& match) -> auto& { return match.TournamentId(); }, Output::IF_NOT_EMPTY},
+            Field{"visitorTeamId", [](auto& match) -> auto& { return match.VisitorTeamId(); }, Output::IF_NOT_EMPTY},
+        };
+    };
+    static_assert(KeysSorted<domain::Match>());
+
+    template<>
+    struct FieldTable<domain::Group> {
+        static constexpr auto fields = std::tuple{
+            Field{"id", [](auto& group) -> auto& { return group.Id(); }, Output::IF_NOT_EMPTY},
+            Field{"name", [](auto& group) -> auto& { return group.Name(); }, Output::ALWAYS, Input::REQUIRED},
+            Field{"teams", [](auto& group) -> auto& { return group.Teams(); }, Output::ALWAYS, Input::IF_ARRAY},
+            Field{"tournamentId", [](auto& group) -> auto& { return group.TournamentId(); }},
+        };
+    };
+    static_assert(KeysSorted<domain::Group>());
+
+    template<>
+    struct FieldTable<domain::BracketSlot> {
+        static constexpr auto fields = std::tuple{
+            Field{"groupName", [](auto& slot) -> auto& { return slot.groupName; }, Output::IF_NOT_EMPTY},
+            Field{"score", [](auto& slot) -> auto& { return slot.score; }},
+            Field{"teamId", [](auto& slot) -> auto& { return slot.teamId; }, Output::IF_NOT_EMPTY},
+            Field{"teamName", [](auto& slot) -> auto& { return slot.teamName; }, Output::IF_NOT_EMPTY},
+        };
+    };
+    static_assert(KeysSorted<domain::BracketSlot>());
+
+    template<>
+    struct FieldTable<domain::BracketMatch> {
+        static constexpr auto fields = std::tuple{
+            Field{"home", [](auto& match) -> auto& { return match.home; }},
+            Field{"id", [](auto& match) -> auto& { return match.id; }},
+            Field{"name", [](auto& match) -> auto& { return match.name; }},
+            Field{"visitor", [](auto& match) -> auto& { return match.visitor; }},
+        };
+    };
+    static_assert(KeysSorted<domain::BracketMatch>());
+
+    template<>
+    struct FieldTable<domain::BracketRound> {
+        static constexpr auto fields = std::tuple{
+            Field{"matches", [](auto& round) -> auto& { return round.matches; }},
+            Field{"number", [](auto& round) -> auto& { return round.number; }},
+        };
+    };
+    static_assert(KeysSorted<domain::BracketRound>());
+
+    template<>
+    struct FieldTable<domain::Bracket> {
+        static constexpr auto fields = std::tuple{
+            Field{"finals", [](auto& bracket) -> auto& { return bracket.finals; }},
+            Field{"losers", [](auto& bracket) -> auto& { return bracket.losers; }},
+            Field{"tournamentId", [](auto& bracket) -> auto& { return bracket.tournamentId; }},
+            Field{"winners", [](auto& bracket) -> auto& { return bracket.winners; }},
+        };
+    };
+    static_assert(KeysSorted<domain::Bracket>());
+
+    // The const getters of TournamentFormat return by value, hence decltype(auto).
+    template<>
+    struct FieldTable<domain::TournamentFormat> {
+        static constexpr auto fields = std::tuple{
+            Field{"maxTeamsPerGroup", [](auto& format) -> decltype(auto) { return format.MaxTeamsPerGroup(); }},
+            Field{"numberOfGroups", [](auto& format) -> decltype(auto) { return format.NumberOfGroups(); }},
+            Field{"type", [](auto& format) -> decltype(auto) { return format.Type(); }},
+        };
+    };
+    static_assert(KeysSorted<domain::TournamentFormat>());
+
+    template<>
+    struct FieldTable<domain::Tournament> {
+        static constexpr auto fields = std::tuple{
+            Field{"format", [](auto& tournament) -> auto& { return tournament.Format(); }},
+            Field{"id", [](auto& tournament) -> auto& { return tournament.Id(); }, Output::IF_NOT_EMPTY},
+            Field{"name", [](auto& tournament) -> auto& { return tournament.Name(); }, Output::ALWAYS, Input::REQUIRED},
+        };
+    };
+    static_assert(KeysSorted<domain::Tournament>());
+}
+
+#endif //DOMAIN_FIELDS_HPP
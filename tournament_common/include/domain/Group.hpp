@@ -18,7 +18,7 @@ namespace domain {
         explicit Group(const std::string_view & name = "", const std::string_view&  id = "") : id(id), name(name) {
         }
 
-        [[nodiscard]] std::string Id() const {
+        [[nodiscard]] const std::string& Id() const {
             return  id;
         }
 
@@ -26,7 +26,7 @@ namespace domain {
             return  id;
         }
 
-        [[nodiscard]] std::string Name() const {
+        [[nodiscard]] const std::string& Name() const {
             return  name;
         }
 
@@ -34,7 +34,7 @@ namespace domain {
             return  name;
         }
 
-        [[nodiscard]] std::string TournamentId() const {
+        [[nodiscard]] const std::string& TournamentId() const {
             return  tournamentId;
         }
 
@@ -28,7 +28,7 @@ namespace domain {
     public:
         Match(/* args */){}
 
-        [[nodiscard]] std::string Id() const {
+        [[nodiscard]] const std::string& Id() const {
             return  id;
         }
 
@@ -36,7 +36,7 @@ namespace domain {
             return  id;
         }
 
-        [[nodiscard]] std::string Name() const {
+        [[nodiscard]] const std::string& Name() const {
             return name;
         }
 
@@ -44,7 +44,7 @@ namespace domain {
             return name;
         }
 
-        [[nodiscard]] std::string TournamentId() const {
+        [[nodiscard]] const std::string& TournamentId() const {
             return  tournamentId;
         }
 
@@ -52,14 +52,14 @@ namespace domain {
             return  tournamentId;
         }
 
-        [[nodiscard]] std::string HomeTeamId() const {
+        [[nodiscard]] const std::string& HomeTeamId() const {
             return homeTeamId;
         }
         std::string & HomeTeamId() {
             return homeTeamId;
         }
 
-        [[nodiscard]] std::string VisitorTeamId() const {
+        [[nodiscard]] const std::string& VisitorTeamId() const {
             return visitorTeamId;
         }
 
@@ -71,7 +71,7 @@ namespace domain {
             return score;
         }
 
-        [[nodiscard]] Score MatchScore() const {
+        [[nodiscard]] const Score& MatchScore() const {
             return score;
         }
     };
@@ -62,7 +62,7 @@ namespace domain {
             this->format = format;
         }
 
-        [[nodiscard]] std::string Id() const {
+        [[nodiscard]] const std::string& Id() const {
             return this->id;
         }
 
@@ -70,7 +70,7 @@ namespace domain {
             return this->id;
         }
 
-        [[nodiscard]] std::string Name() const {
+        [[nodiscard]] const std::string& Name() const {
             return this->name;
         }
 
@@ -78,7 +78,7 @@ namespace domain {
             return this->name;
         }
 
-        [[nodiscard]] TournamentFormat Format() const {
+        [[nodiscard]] const TournamentFormat& Format() const {
             return this->format;
         }
 
@@ -90,7 +90,15 @@ namespace domain {
             return this->groups;
         }
 
-        [[nodiscard]] std::vector<Match> Matches() const {
+        [[nodiscard]] const std::vector<Group>& Groups() const {
+            return this->groups;
+        }
+
+        [[nodiscard]] std::vector<Match> & Matches() {
+            return this->matches;
+        }
+
+        [[nodiscard]] const std::vector<Match>& Matches() const {
             return this->matches;
         }
     };
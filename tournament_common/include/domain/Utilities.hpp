@@ -1,7 +1,12 @@
 #ifndef DOMAIN_UTILITIES_HPP
 #define DOMAIN_UTILITIES_HPP
 
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 #include <nlohmann/json.hpp>
+#include "domain/Fields.hpp"
 #include "domain/Team.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Group.hpp"
@@ -9,39 +14,6 @@
 
 namespace domain {
 
-    inline void to_json(nlohmann::json& json, const Team& team) {
-        json = {{"id", team.Id}, {"name", team.Name}};
-    }
-
-    inline void from_json(const nlohmann::json& json, Team& team) {
-        if(json.contains("id")) {
-            json.at("id").get_to(team.Id);
-        }
-        json.at("name").get_to(team.Name);
-    }
-
-    inline void from_json(const nlohmann::json& json, std::vector<Team>& teams) {
-        for (auto j = json.begin(); j != json.end(); ++j) {
-            Team team;
-            if(j.value().contains("id")) {
-                j.value().at("id").get_to(team.Id);
-            }
-            if(j.value().contains("name")) {
-                j.value().at("name").get_to(team.Name);
-            }
-            teams.push_back(team);
-        }
-    }
-
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Team>& team) {
-        json = nlohmann::basic_json();
-        json["name"] = team->Name;
-
-        if (!team->Id.empty()) {
-            json["id"] = team->Id;
-        }
-    }
-
     inline TournamentType fromString(std::string_view type) {
         if (type == "DOUBLE_ELIMINATION")
             return TournamentType::DOUBLE_ELIMINATION;
@@ -49,103 +21,85 @@ namespace domain {
         return TournamentType::DOUBLE_ELIMINATION;
     }
 
-    inline void from_json(const nlohmann::json& json, TournamentFormat& format) {
-        if(json.contains("maxTeamsPerGroup"))
-            json.at("maxTeamsPerGroup").get_to(format.MaxTeamsPerGroup());
-        if(json.contains("numberOfGroups"))
-            json.at("numberOfGroups").get_to(format.NumberOfGroups());
-        if(json.contains("type"))
-            format.Type() = fromString(json["type"].get<std::string>());
-    }
-
-    inline void to_json(nlohmann::json& json, const TournamentFormat& format) {
-        json = {{"maxTeamsPerGroup", format.MaxTeamsPerGroup()}, {"numberOfGroups", format.NumberOfGroups()}};
-        switch (format.Type()) {
+    inline std::string_view toString(TournamentType type) {
+        switch (type) {
             case TournamentType::DOUBLE_ELIMINATION:
-                json["type"] = "DOUBLE_ELIMINATION";
-                break;
+                return "DOUBLE_ELIMINATION";
             default:
-                json["type"] = "DOUBLE_ELIMINATION";
+                return "DOUBLE_ELIMINATION";
         }
     }
 
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Tournament>& tournament) {
-        json = {{"name", tournament->Name()}};
-        if (!tournament->Id().empty()) {
-            json["id"] = tournament->Id();
-        }
-        json["format"] = tournament->Format();
+    inline void to_json(nlohmann::json& json, TournamentType type) {
+        json = toString(type);
     }
 
-    inline void from_json(const nlohmann::json& json, std::shared_ptr<Tournament>& tournament) {
-        if(json.contains("id")) {
-            tournament->Id() = json["id"].get<std::string>();
-        }
-        json["name"].get_to(tournament->Name());
-        if (json.contains("format"))
-            json.at("format").get_to(tournament->Format());
+    inline void from_json(const nlohmann::json& json, TournamentType& type) {
+        type = fromString(json.get<std::string>());
     }
 
-    inline void to_json(nlohmann::json& json, const Tournament& tournament) {
-        json = {{"name", tournament.Name()}};
-        if (!tournament.Id().empty()) {
-            json["id"] = tournament.Id();
+    namespace detail {
+        // One find per field, keyed by the table's static strings. Lenient reads (entries of a nested list)
+        // treat every field as optional.
+        template<serialization::Described T>
+        void ReadFields(const nlohmann::json& json, T& entity, bool lenient) {
+            serialization::ForEachField<T>([&](const auto& field) {
+                const auto member = json.find(field.key);
+                if (member == json.end()) {
+                    if (!lenient && field.input == serialization::Input::REQUIRED) {
+                        // at() raises the same exception nlohmann reports for any missing key
+                        static_cast<void>(json.at(field.key));
+                    }
+                    return;
+                }
+                if (field.input == serialization::Input::IF_ARRAY && !member->is_array()) {
+                    return;
+                }
+                member->get_to(field.access(entity));
+            });
         }
-        json["format"] = tournament.Format();
     }
 
-    inline void from_json(const nlohmann::json& json, Tournament& tournament) {
-        if(json.contains("id")) {
-            tournament.Id() = json["id"].get<std::string>();
-        }
-        json["name"].get_to(tournament.Name());
-        if (json.contains("format"))
-            json.at("format").get_to(tournament.Format());
+    template<serialization::Described T>
+    void to_json(nlohmann::json& json, const T& entity) {
+        json = nlohmann::json::object();
+        serialization::ForEachField<T>([&](const auto& field) {
+            const auto& value = field.access(entity);
+            if (field.output == serialization::Output::IF_NOT_EMPTY && serialization::IsEmpty(value)) {
+                return;
+            }
+            json.emplace(field.key, value);
+        });
     }
 
-    inline void from_json(const nlohmann::json& json, Group& group) {
-        if(json.contains("id")) {
-            group.Id() = json["id"].get<std::string>();
-        }
-        if(json.contains("tournamentId")) {
-            group.TournamentId() = json["tournamentId"].get<std::string>();
-        }
-        json["name"].get_to(group.Name());
-        if(json.contains("teams") && json["teams"].is_array()) {
-            json["teams"].get_to(group.Teams());
-        }
+    template<serialization::Described T>
+    void from_json(const nlohmann::json& json, T& entity) {
+        detail::ReadFields(json, entity, false);
     }
 
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Group>& group) {
-        json["name"] = group->Name();
-        json["tournamentId"] = group->TournamentId();
-        if (!group->Id().empty()) {
-            json["id"] = group->Id();
+    template<serialization::Described T>
+    void to_json(nlohmann::json& json, const std::shared_ptr<T>& entity) {
+        if (entity) {
+            to_json(json, *entity);
+        } else {
+            json = nullptr;
         }
-        json["teams"] = group->Teams();
     }
 
-    inline void to_json(nlohmann::json& json, const std::vector<std::shared_ptr<Group>>& groups) {
-        json = nlohmann::json::array();
-        for (const auto& group : groups) {
-            auto jsonGroup = nlohmann::json();
-            jsonGroup["name"] = group->Name();
-            jsonGroup["tournamentId"] = group->TournamentId();
-            if (!group->Id().empty()) {
-                jsonGroup["id"] = group->Id();
-            }
-            jsonGroup["teams"] = group->Teams();
-            json.push_back(jsonGroup);
+    template<serialization::Described T>
+    void from_json(const nlohmann::json& json, std::shared_ptr<T>& entity) {
+        if (!entity) {
+            entity = std::make_shared<T>();
         }
+        from_json(json, *entity);
     }
 
-    inline void to_json(nlohmann::json& json, const Group& group) {
-        json["name"] = group.Name();
-        json["tournamentId"] = group.TournamentId();
-        if (!group.Id().empty()) {
-            json["id"] = group.Id();
+    // Teams stored inside a group may carry only an id or only a name.
+    inline void from_json(const nlohmann::json& json, std::vector<Team>& teams) {
+        teams.clear();
+        for (const auto& entry : json) {
+            detail::ReadFields(entry, teams.emplace_back(), true);
         }
-        json["teams"] = group.Teams();
     }
 
     // inline std::string bracketTypeToString(BracketType type) {
@@ -163,90 +117,6 @@ namespace domain {
     //     if (type == "FINAL") return BracketType::FINAL;
     //     return BracketType::WINNERS;
     // }
-
-    inline void to_json(nlohmann::json& json, const Score& score) {
-        json = {
-            {"homeTeamScore", score.homeTeamScore},
-            {"visitorTeamScore", score.visitorTeamScore}
-        };
-    }
-
-    inline void from_json(const nlohmann::json& json, Score& score) {
-        if (json.contains("homeTeamScore"))
-            json.at("homeTeamScore").get_to(score.homeTeamScore);
-        if (json.contains("visitorTeamScore"))
-            json.at("visitorTeamScore").get_to(score.visitorTeamScore);
-    }
-
-    inline void to_json(nlohmann::json& json, const Match& match) {
-        json = nlohmann::json::object();
-        if (!match.Id().empty()) {
-            json["id"] = match.Id();
-        }
-        if (!match.Name().empty()) {
-            json["name"] = match.Name();
-        }
-        if (!match.TournamentId().empty()) {
-            json["tournamentId"] = match.TournamentId();
-        }
-        if (!match.HomeTeamId().empty()) {
-            json["homeTeamId"] = match.HomeTeamId();
-        }
-        if (!match.VisitorTeamId().empty()) {
-            json["visitorTeamId"] = match.VisitorTeamId();
-        }
-        json["score"] = match.MatchScore();
-    }
-
-    inline void from_json(const nlohmann::json& json, Match& match) {
-        if (json.contains("id")) {
-            match.Id() = json["id"].get<std::string>();
-        }
-        if (json.contains("name")) {
-            match.Name() = json["name"].get<std::string>();
-        }
-        if (json.contains("tournamentId")) {
-            match.TournamentId() = json["tournamentId"].get<std::string>();
-        }
-        if (json.contains("homeTeamId")) {
-            match.HomeTeamId() = json["homeTeamId"].get<std::string>();
-        }
-        if (json.contains("visitorTeamId")) {
-            match.VisitorTeamId() = json["visitorTeamId"].get<std::string>();
-        }
-        if (json.contains("score")) {
-            json.at("score").get_to(match.MatchScore());
-        }
-    }
-
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Match>& match) {
-        json = nlohmann::json::object();
-        if (!match->Id().empty()) {
-            json["id"] = match->Id();
-        }
-        if (!match->Name().empty()) {
-            json["name"] = match->Name();
-        }
-        if (!match->TournamentId().empty()) {
-            json["tournamentId"] = match->TournamentId();
-        }
-        if (!match->HomeTeamId().empty()) {
-            json["homeTeamId"] = match->HomeTeamId();
-        }
-        if (!match->VisitorTeamId().empty()) {
-            json["visitorTeamId"] = match->VisitorTeamId();
-        }
-        json["score"] = match->MatchScore();
-    }
-
-    inline void to_json(nlohmann::json& json, const std::vector<std::shared_ptr<Match>>& matches) {
-        json = nlohmann::json::array();
-        for (const auto& match : matches) {
-            nlohmann::json matchJson;
-            to_json(matchJson, match);
-            json.push_back(matchJson);
-        }
-    }
 }
 
 #endif /* FC7CD637_41CC_48DE_8D8A_BC2CFC528D72 */
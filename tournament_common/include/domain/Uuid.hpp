@@ -0,0 +1,99 @@
+#ifndef TOURNAMENT_COMMON_UUID_HPP
+#define TOURNAMENT_COMMON_UUID_HPP
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Fixed-format UUID validation (8-4-4-4-12 hex digits, any case) used in place of a regex.
+namespace domain {
+    namespace uuid {
+        inline constexpr std::size_t LENGTH = 36;
+
+        inline constexpr std::array<bool, 256> HEX_TABLE = [] {
+            std::array<bool, 256> table{};
+            for (char c = '0'; c <= '9'; ++c) table[static_cast<unsigned char>(c)] = true;
+            for (char c = 'a'; c <= 'f'; ++c) table[static_cast<unsigned char>(c)] = true;
+            for (char c = 'A'; c <= 'F'; ++c) table[static_cast<unsigned char>(c)] = true;
+            return table;
+        }();
+
+        constexpr bool IsDashPosition(std::size_t position) noexcept {
+            return position == 8 || position == 13 || position == 18 || position == 23;
+        }
+
+        constexpr bool IsValidScalar(std::string_view value) noexcept {
+            if (value.size() != LENGTH) {
+                return false;
+            }
+            for (std::size_t i = 0; i < LENGTH; ++i) {
+                const auto c = static_cast<unsigned char>(value[i]);
+                if (IsDashPosition(i) ? c != '-' : !HEX_TABLE[c]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+#if defined(__SSE2__)
+        // Checks 16 bytes at once: every byte must be a hex digit except the ones flagged in dashMask, which must be '-'.
+        inline bool IsValidBlock(const char* data, int dashMask) noexcept {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            const __m128i lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+
+            const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)),
+                                                _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+            const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                                _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+            const __m128i dash = _mm_cmpeq_epi8(block, _mm_set1_epi8('-'));
+
+            const int hexMask = _mm_movemask_epi8(_mm_or_si128(digit, alpha));
+            const int dashHits = _mm_movemask_epi8(dash);
+            return ((hexMask & ~dashMask) | (dashHits & dashMask)) == 0xFFFF;
+        }
+
+        inline bool IsValidSimd(std::string_view value) noexcept {
+            if (value.size() != LENGTH) {
+                return false;
+            }
+            // dashes at 8 and 13 in the first block, 18 and 23 (2 and 7 relative) in the second one
+            constexpr int firstDashes = (1 << 8) | (1 << 13);
+            constexpr int secondDashes = (1 << 2) | (1 << 7);
+            return IsValidBlock(value.data(), firstDashes)
+                && IsValidBlock(value.data() + 16, secondDashes)
+                && HEX_TABLE[static_cast<unsigned char>(value[32])]
+                && HEX_TABLE[static_cast<unsigned char>(value[33])]
+                && HEX_TABLE[static_cast<unsigned char>(value[34])]
+                && HEX_TABLE[static_cast<unsigned char>(value[35])];
+        }
+#endif
+    }
+
+    constexpr bool IsValidId(std::string_view value) noexcept {
+#if defined(__SSE2__)
+        if !consteval {
+            return uuid::IsValidSimd(value);
+        }
+#endif
+        return uuid::IsValidScalar(value);
+    }
+
+    // Postgres renders uuid values in lowercase, so ids that are matched against text coming back from it
+    // (NOTIFY payloads, RETURNING columns) or used as in-memory keys go through this first.
+    inline std::string CanonicalId(std::string_view value) {
+        std::string id(value);
+        for (char& c : id) {
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+        }
+        return id;
+    }
+}
+
+#endif // TOURNAMENT_COMMON_UUID_HPP
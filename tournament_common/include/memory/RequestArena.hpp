@@ -0,0 +1,79 @@
+#ifndef TOURNAMENT_COMMON_REQUEST_ARENA_HPP
+#define TOURNAMENT_COMMON_REQUEST_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+// Per-request arena for the objects a handler reads, works on and throws away. While a RequestScope is open
+// on a thread, RequestResource() is that thread's monotonic arena: allocations are a pointer bump, frees are
+// no-ops and the whole arena is released in one step when the outermost scope closes. Without a scope
+// (consumer, tests, startup) it is the default heap resource, so shared code behaves as before.
+//
+// Single reads come from MakeShared, list reads from MakeList. Only the object, control block or element
+// buffer lives in the arena: members such as std::string still allocate on the heap.
+//
+// Anything allocated from the arena must die with the request: never cache it, queue it or hand it to
+// another thread.
+namespace memory {
+    class RequestArena {
+        // Large enough that a request rarely has to go upstream.
+        static constexpr std::size_t INITIAL_SIZE = 64 * 1024;
+
+        std::unique_ptr<std::byte[]> buffer = std::make_unique<std::byte[]>(INITIAL_SIZE);
+        std::pmr::monotonic_buffer_resource resource{buffer.get(), INITIAL_SIZE, std::pmr::new_delete_resource()};
+        int depth = 0;
+
+        friend class RequestScope;
+
+    public:
+        static RequestArena& ForThread() {
+            thread_local RequestArena arena;
+            return arena;
+        }
+
+        std::pmr::memory_resource* Resource() {
+            return depth > 0 ? &resource : std::pmr::get_default_resource();
+        }
+    };
+
+    // Opened around every route handler; nested scopes (a handler calling another) share the outer arena.
+    class RequestScope {
+        RequestArena& arena;
+
+    public:
+        RequestScope() : arena(RequestArena::ForThread()) { ++arena.depth; }
+
+        ~RequestScope() {
+            if (--arena.depth == 0) {
+                arena.resource.release();
+            }
+        }
+
+        RequestScope(const RequestScope&) = delete;
+        RequestScope& operator=(const RequestScope&) = delete;
+    };
+
+    inline std::pmr::memory_resource* RequestResource() {
+        return RequestArena::ForThread().Resource();
+    }
+
+    // make_shared counterpart: object and control block come from the current request arena in one bump.
+    template<typename T, typename... Args>
+    std::shared_ptr<T> MakeShared(Args&&... args) {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(RequestResource()), std::forward<Args>(args)...);
+    }
+
+    // Element buffer of a list read, reserved for capacity in the current request arena. Copies of the
+    // vector go back to the default resource; moving it keeps the arena, so it must not leave the request.
+    template<typename T>
+    std::pmr::vector<T> MakeList(std::size_t capacity) {
+        std::pmr::vector<T> list(RequestResource());
+        list.reserve(capacity);
+        return list;
+    }
+}
+
+#endif //TOURNAMENT_COMMON_REQUEST_ARENA_HPP
@@ -5,6 +5,8 @@
 #ifndef TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <functional>
 
@@ -33,9 +35,25 @@ public:
 };
 
 
+// Snapshot of the pool for admission control and monitoring. averageWait is a moving average of how long
+// Connection() blocked before handing out a connection.
+struct PoolStatistics {
+    std::size_t size = 0;
+    std::size_t idle = 0;
+    std::size_t waiting = 0;
+    std::chrono::microseconds averageWait{0};
+};
+
 class IDbConnectionProvider {
 public:
     virtual ~IDbConnectionProvider() = default;
     virtual PooledConnection Connection() = 0;
+    virtual PoolStatistics Statistics() { return {}; }
+    // Round trip to the database for readiness checks, independent of pool load. False on connection or query
+    // failure, or if the query does not answer within timeout.
+    virtual bool Ping(std::chrono::milliseconds /*timeout*/) { return true; }
+    // Shutdown: closes the connections once they are all back in the pool. False if some were still
+    // borrowed at timeout; the idle ones are closed anyway.
+    virtual bool Close(std::chrono::milliseconds /*timeout*/) { return true; }
 };
 #endif //TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
\ No newline at end of file
@@ -4,34 +4,73 @@
 
 #ifndef TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
+#include <chrono>
 #include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <queue>
+#include <string>
 #include <pqxx/pqxx>
 
 #include "IDbConnectionProvider.hpp"
 #include "PostgresConnection.hpp"
 
 class PostgresConnectionProvider : public IDbConnectionProvider{
-    std::string_view connectionString;
+    // kept (not a view) because the readiness probe connects after construction
+    std::string connectionString;
     size_t poolSize = 1;
     std::queue<std::unique_ptr<pqxx::connection>> connectionPool;
     std::mutex connectionPoolMutex;
     std::condition_variable connectionPoolCondition;
+    // guarded by connectionPoolMutex; averageWait is a moving average (1/8 weight per sample)
+    std::size_t waiting = 0;
+    std::chrono::microseconds averageWait{0};
+    // Readiness probe connection, outside the pool: a busy pool must not read as a database that is down.
+    // Opened on first use and again after any failure.
+    std::mutex probeMutex;
+    std::unique_ptr<pqxx::connection> probeConnection;
 
 public:
     PostgresConnectionProvider(std::string_view connectionString, size_t poolSize) : connectionString(connectionString), poolSize(poolSize) {
         for (size_t i = 0; i < poolSize; i++) {
-            connectionPool.push(std::make_unique<pqxx::connection>(connectionString.data()));
+            connectionPool.push(std::make_unique<pqxx::connection>(this->connectionString));
             connectionPool.back()->prepare("insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id");
             connectionPool.back()->prepare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1");
             connectionPool.back()->prepare("update_tournament", "UPDATE TOURNAMENTS SET document = document || $1::jsonb WHERE id = $2 RETURNING document");
             connectionPool.back()->prepare("delete_tournament", "DELETE FROM TOURNAMENTS WHERE id = $1");
             connectionPool.back()->prepare("insert_team", "insert into TEAMS (document) values($1) RETURNING id");
+            // bulk insert: one row per array element, names that already exist are skipped and come back with a
+            // null id at their position
+            connectionPool.back()->prepare("insert_teams", R"(
+                with input as (
+                    select position, document from jsonb_array_elements($1::jsonb) with ordinality as t(document, position)
+                ), inserted as (
+                    insert into TEAMS (document)
+                    select document from input order by position
+                    on conflict ((document->>'name')) do nothing
+                    returning id, document->>'name' as name
+                )
+                select inserted.id from input left join inserted on inserted.name = input.document->>'name'
+                order by input.position
+            )");
             connectionPool.back()->prepare("select_team_by_id", "select * from TEAMS where id = $1");
+            connectionPool.back()->prepare("select_teams_by_ids", R"(
+                select id, document->>'name' as name from TEAMS
+                where id in (select value::uuid from jsonb_array_elements_text($1::jsonb))
+            )");
             connectionPool.back()->prepare("update_team", "UPDATE TEAMS SET document = document || $1::jsonb WHERE id = $2 RETURNING document");
             connectionPool.back()->prepare("delete_team", "DELETE FROM TEAMS WHERE id = $1");
+            // read endpoints: the database renders the response array itself (id merged into each document)
+            connectionPool.back()->prepare("render_teams", R"(
+                select coalesce(jsonb_agg(jsonb_build_object('id', id, 'name', coalesce(document->>'name', ''))), '[]'::jsonb)::text as body
+                from TEAMS
+            )");
             connectionPool.back()->prepare("insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id");
             connectionPool.back()->prepare("select_groups_by_tournament", "select * from GROUPS where tournament_id = $1");
+            connectionPool.back()->prepare("render_groups_by_tournament", R"(
+                select coalesce(jsonb_agg(document || jsonb_build_object('id', id, 'tournamentId', tournament_id)), '[]'::jsonb)::text as body
+                from GROUPS where tournament_id = $1
+            )");
             connectionPool.back()->prepare("select_group_in_tournament", R"(
                 select * from groups
                 where  tournament_id = $1
@@ -39,16 +78,18 @@ public:
             )");
 
             connectionPool.back()->prepare("select_group_by_tournamentid_groupid", "select * from GROUPS where tournament_id = $1 and id = $2");
-            connectionPool.back()->prepare("select_group_by_group_id_team_id", R"(
-                select * from groups
-                where id = $1
-                and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
+            // $2 is a JSON array of team ids; returns the ones already in the group
+            connectionPool.back()->prepare("select_group_team_ids_in", R"(
+                select member->>'id' as id
+                from groups, jsonb_array_elements(coalesce(document->'teams', '[]'::jsonb)) as member
+                where groups.id = $1
+                and member->>'id' in (select jsonb_array_elements_text($2::jsonb))
             )");
             connectionPool.back()->prepare("update_group", "UPDATE GROUPS SET document = $2, last_update_date = CURRENT_TIMESTAMP WHERE id = $1 RETURNING document");
-            connectionPool.back()->prepare("update_group_add_team", R"(
+            connectionPool.back()->prepare("update_group_add_teams", R"(
                 update groups
-                    set document = jsonb_insert(
-                            document, '{teams,-1}', $2
+                    set document = jsonb_set(
+                            document, '{teams}', coalesce(document->'teams', '[]'::jsonb) || $2::jsonb
                                    ),
                     last_update_date = CURRENT_TIMESTAMP
                 where id = $1
@@ -56,19 +97,78 @@ public:
             connectionPool.back()->prepare("delete_group", "DELETE FROM GROUPS WHERE id = $1 RETURNING id");
             connectionPool.back()->prepare("insert_match", "insert into MATCHES (tournament_id, document) values($1, $2) RETURNING id");
             connectionPool.back()->prepare("select_matches_by_tournament", "select * from MATCHES where tournament_id = $1");
+            connectionPool.back()->prepare("render_matches_by_tournament", R"(
+                select coalesce(jsonb_agg(document || jsonb_build_object('id', id)), '[]'::jsonb)::text as body
+                from MATCHES where tournament_id = $1
+            )");
+            // sparse fieldsets (?fields=): $2 is a text[] of the document keys to leave out
+            connectionPool.back()->prepare("select_matches_fields_by_tournament",
+                "select id, document - $2::text[] as document from MATCHES where tournament_id = $1");
+            connectionPool.back()->prepare("render_matches_fields_by_tournament", R"(
+                select coalesce(jsonb_agg((document || jsonb_build_object('id', id)) - $2::text[]), '[]'::jsonb)::text as body
+                from MATCHES where tournament_id = $1
+            )");
+            // validator for the rendered list: no row when the tournament does not exist. The revision sum moves
+            // on every update whatever order concurrent writers commit in; the latest timestamp covers inserts.
+            connectionPool.back()->prepare("version_matches_by_tournament", R"(
+                select count(m.id) || '-' || coalesce(sum(m.revision), 0) || '-'
+                    || coalesce(to_char(max(m.last_update_date), 'YYYYMMDDHH24MISSUS'), '0') as version
+                from TOURNAMENTS t left join MATCHES m on m.tournament_id = t.id
+                where t.id = $1
+                group by t.id
+            )");
+            // one row per match with both teams and their groups resolved; a single row of nulls for a
+            // tournament without matches, no row when the tournament does not exist
+            connectionPool.back()->prepare("select_bracket_by_tournament", R"(
+                select m.id, m.document->>'name' as name,
+                       m.document->>'homeTeamId' as home_team_id, ht.document->>'name' as home_team_name,
+                       hg.name as home_group_name, coalesce((m.document->'score'->>'homeTeamScore')::int, 0) as home_score,
+                       m.document->>'visitorTeamId' as visitor_team_id, vt.document->>'name' as visitor_team_name,
+                       vg.name as visitor_group_name, coalesce((m.document->'score'->>'visitorTeamScore')::int, 0) as visitor_score
+                from TOURNAMENTS t
+                left join MATCHES m on m.tournament_id = t.id
+                left join TEAMS ht on ht.id = nullif(m.document->>'homeTeamId', '')::uuid
+                left join TEAMS vt on vt.id = nullif(m.document->>'visitorTeamId', '')::uuid
+                left join lateral (
+                    select g.document->>'name' as name from GROUPS g
+                    where g.tournament_id = t.id
+                    and g.document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', m.document->>'homeTeamId')))
+                    limit 1
+                ) hg on true
+                left join lateral (
+                    select g.document->>'name' as name from GROUPS g
+                    where g.tournament_id = t.id
+                    and g.document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', m.document->>'visitorTeamId')))
+                    limit 1
+                ) vg on true
+                where t.id = $1
+            )");
             connectionPool.back()->prepare("select_match_by_tournamentid_matchid", "select * from MATCHES where tournament_id = $1 and id = $2");
             connectionPool.back()->prepare("select_match_by_tournamentid_name", "select * from MATCHES where tournament_id = $1 and document->>'name' = $2");
             connectionPool.back()->prepare("update_match_score", "UPDATE MATCHES SET document = jsonb_set(document, '{score}', $2::jsonb), last_update_date = CURRENT_TIMESTAMP WHERE id = $1");
+            // $1: [{"id", "tournamentId", "score"}], one entry per match
+            connectionPool.back()->prepare("update_match_scores", R"(
+                update MATCHES m
+                    set document = jsonb_set(m.document, '{score}', u.score), last_update_date = CURRENT_TIMESTAMP
+                from jsonb_to_recordset($1::jsonb) as u(id uuid, "tournamentId" uuid, score jsonb)
+                where m.id = u.id and m.tournament_id = u."tournamentId"
+                returning m.id
+            )");
             connectionPool.back()->prepare("update_match", "UPDATE MATCHES SET document = $2, last_update_date = CURRENT_TIMESTAMP WHERE id = $1 RETURNING document");
             connectionPool.back()->prepare("delete_match", "DELETE FROM MATCHES WHERE id = $1");
         }
     }
 
     PooledConnection Connection() override {
+        const auto waitStart = std::chrono::steady_clock::now();
         std::unique_lock lock(connectionPoolMutex);
 
         // wait until a connection is available
+        ++waiting;
         connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
+        --waiting;
+        const auto waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart);
+        averageWait += (waited - averageWait) / 8;
 
         // take one out
         auto conn = std::move(connectionPool.front());
@@ -93,5 +193,51 @@ public:
             }
         );
     }
+
+    PoolStatistics Statistics() override {
+        std::lock_guard lock(connectionPoolMutex);
+        return {poolSize, connectionPool.size(), waiting, averageWait};
+    }
+
+    // Waits for every borrowed connection to come back, then closes them. Returns are signalled with
+    // notify_one, which may wake a request instead, so the wait re-checks periodically.
+    bool Close(std::chrono::milliseconds timeout) override {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        std::unique_lock lock(connectionPoolMutex);
+        bool complete = true;
+        while (connectionPool.size() < poolSize) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                complete = false;
+                break;
+            }
+            connectionPoolCondition.wait_for(lock, std::chrono::milliseconds(50));
+        }
+        while (!connectionPool.empty()) {
+            connectionPool.front()->close();
+            connectionPool.pop();
+        }
+        std::lock_guard probeLock(probeMutex);
+        probeConnection.reset();
+        return complete;
+    }
+
+    // Round trip on the dedicated probe connection, so the answer depends on the database only, never on how
+    // busy the pool is. timeout bounds the query; a failed connection is dropped and reopened next time.
+    bool Ping(std::chrono::milliseconds timeout) override {
+        std::lock_guard lock(probeMutex);
+        try {
+            if (!probeConnection || !probeConnection->is_open()) {
+                probeConnection = std::make_unique<pqxx::connection>(connectionString);
+                pqxx::nontransaction tx(*probeConnection);
+                tx.exec("set statement_timeout = " + std::to_string(timeout.count()));
+            }
+            pqxx::nontransaction tx(*probeConnection);
+            tx.exec("select 1");
+            return true;
+        } catch (const std::exception&) {
+            probeConnection.reset();
+            return false;
+        }
+    }
 };
 #endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
\ No newline at end of file
@@ -22,12 +22,13 @@ public:
     std::string Create (const domain::Group & entity) override;
     std::string Update (const domain::Group & entity) override;
     void Delete(std::string id) override;
-    std::vector<std::shared_ptr<domain::Group>> ReadAll() override;
-    std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const std::string_view& tournamentId) override;
+    std::vector<domain::Group> ReadAll() override;
+    std::vector<domain::Group> FindByTournamentId(const std::string_view& tournamentId) override;
+    std::string FindByTournamentIdAsJson(const std::string_view& tournamentId) override;
     std::shared_ptr<domain::Group> FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) override;
     std::shared_ptr<domain::Group> FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) override;
-    std::shared_ptr<domain::Group> FindByGroupIdAndTeamId(const std::string_view& groupId, const std::string_view& teamId) override;
-    void UpdateGroupAddTeam(const std::string_view& groupId, const std::shared_ptr<domain::Team> & team) override;
+    std::vector<std::string> FindTeamIdsInGroup(const std::string_view& groupId, const std::vector<std::string>& teamIds) override;
+    void UpdateGroupAddTeams(const std::string_view& groupId, const std::vector<domain::Team>& teams) override;
 };
 
 #endif //TOURNAMENTS_GROUPREPOSITORY_HPP
\ No newline at end of file
@@ -5,6 +5,10 @@
 #ifndef COMMON_IGROUPREPOSITORY_HPP
 #define COMMON_IGROUPREPOSITORY_HPP
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "domain/Group.hpp"
 #include "IRepository.hpp"
 
@@ -12,10 +16,14 @@
 class IGroupRepository : public IRepository<domain::Group, std::string> {
 public:
     virtual ~IGroupRepository() = default;
-    virtual std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const std::string_view& tournamentId) = 0;
+    virtual std::vector<domain::Group> FindByTournamentId(const std::string_view& tournamentId) = 0;
+    // Same groups as a JSON array rendered by the database, ready to be sent as is
+    virtual std::string FindByTournamentIdAsJson(const std::string_view& tournamentId) = 0;
     virtual std::shared_ptr<domain::Group> FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
     virtual std::shared_ptr<domain::Group> FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) = 0;
-    virtual std::shared_ptr<domain::Group> FindByGroupIdAndTeamId(const std::string_view& groupId, const std::string_view& teamId) = 0;
-    virtual void UpdateGroupAddTeam(const std::string_view& groupId, const std::shared_ptr<domain::Team> & team) = 0;
+    // Which of teamIds are already members of the group, in one query
+    virtual std::vector<std::string> FindTeamIdsInGroup(const std::string_view& groupId, const std::vector<std::string>& teamIds) = 0;
+    // Appends every team to the group's member list in one statement
+    virtual void UpdateGroupAddTeams(const std::string_view& groupId, const std::vector<domain::Team>& teams) = 0;
 };
 #endif //COMMON_IGROUPREPOSITORY_HPP
\ No newline at end of file
@@ -5,20 +5,40 @@
 #ifndef TOURNAMENTS_IMATCHREPOSITORY_HPP
 #define TOURNAMENTS_IMATCHREPOSITORY_HPP
 
+#include <memory_resource>
 #include <string_view>
 #include <vector>
 #include <memory>
+#include <string>
+#include <optional>
 
+#include "domain/Bracket.hpp"
+#include "domain/Fields.hpp"
 #include "domain/Match.hpp"
+#include "serialization/FieldSet.hpp"
 #include "IRepository.hpp"
 
 class IMatchRepository {
 public:
     virtual ~IMatchRepository() = default;
-    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(const std::string_view& tournamentId) = 0;
+    // Only the members in fields are read from the stored documents; the others keep their defaults.
+    // List reads are allocated from the request arena (memory::MakeList)
+    virtual std::pmr::vector<domain::Match> FindByTournamentId(const std::string_view& tournamentId,
+                                                          const serialization::FieldSet<domain::Match>& fields) = 0;
+    // Same matches as a JSON array rendered by the database, ready to be sent as is, with only the members in fields
+    virtual std::string FindByTournamentIdAsJson(const std::string_view& tournamentId,
+                                                 const serialization::FieldSet<domain::Match>& fields) = 0;
+    // Changes whenever a match of the tournament is added, updated or removed (row count, sum of row
+    // revisions and latest last_update_date); nullopt when the tournament does not exist
+    virtual std::optional<std::string> FindVersionByTournamentId(const std::string_view& tournamentId) = 0;
+    // Every match with its teams' names and groups, from one query; nullopt when the tournament does not exist
+    virtual std::optional<std::pmr::vector<domain::BracketMatch>> FindBracketByTournamentId(const std::string_view& tournamentId) = 0;
     virtual std::shared_ptr<domain::Match> FindByTournamentIdAndMatchId(const std::string_view& tournamentId, const std::string_view& matchId) = 0;
     virtual std::shared_ptr<domain::Match> FindByTournamentIdAndName(const std::string_view& tournamentId, const std::string_view& name) = 0;
     virtual void UpdateMatchScore(const std::string_view& matchId, const domain::Score& score) = 0;
+    // Writes every match's score in one statement (ids must be distinct); returns the ids that exist in their
+    // tournament and were updated
+    virtual std::vector<std::string> UpdateMatchScores(const std::vector<domain::Match>& matches) = 0;
     virtual void Update(const std::string_view& matchId, const domain::Match& match) = 0;
     virtual std::vector<std::string> CreateBulk(const std::vector<domain::Match>& matches) = 0; //agregar todos los matches de una vez
     virtual bool MatchesExistForTournament(const std::string_view& tournamentId) = 0;
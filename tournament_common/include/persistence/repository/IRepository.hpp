@@ -15,6 +15,6 @@ public:
     virtual Id Create (const Type & entity) = 0;
     virtual Id Update (const Type & entity) = 0;
     virtual void Delete(Id id) = 0;
-    virtual std::vector<std::shared_ptr<Type>> ReadAll() = 0;
+    virtual std::vector<Type> ReadAll() = 0;
 };
 #endif //RESTAPI_IREPOSITORY_HPP
\ No newline at end of file
@@ -0,0 +1,23 @@
+#ifndef COMMON_ITEAMREPOSITORY_HPP
+#define COMMON_ITEAMREPOSITORY_HPP
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "domain/Team.hpp"
+#include "IRepository.hpp"
+
+class ITeamRepository : public IRepository<domain::Team, std::string_view> {
+public:
+    virtual ~ITeamRepository() = default;
+    // JSON array of every team, rendered by the database in the response shape
+    virtual std::string ReadAllAsJson() = 0;
+    // The teams among ids that exist, in no particular order
+    virtual std::vector<domain::Team> ReadByIds(const std::vector<std::string>& ids) = 0;
+    // Inserts every team in one statement. Ids come back in input order; nullopt where the name already
+    // existed, which leaves the rest of the batch in place.
+    virtual std::vector<std::optional<std::string>> CreateMany(const std::vector<domain::Team>& teams) = 0;
+};
+#endif //COMMON_ITEAMREPOSITORY_HPP
@@ -14,10 +14,16 @@ class MatchRepository : public IMatchRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
 public:
     explicit MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
-    std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(const std::string_view& tournamentId) override;
+    std::pmr::vector<domain::Match> FindByTournamentId(const std::string_view& tournamentId,
+                                                  const serialization::FieldSet<domain::Match>& fields) override;
+    std::string FindByTournamentIdAsJson(const std::string_view& tournamentId,
+                                         const serialization::FieldSet<domain::Match>& fields) override;
+    std::optional<std::string> FindVersionByTournamentId(const std::string_view& tournamentId) override;
+    std::optional<std::pmr::vector<domain::BracketMatch>> FindBracketByTournamentId(const std::string_view& tournamentId) override;
     std::shared_ptr<domain::Match> FindByTournamentIdAndMatchId(const std::string_view& tournamentId, const std::string_view& matchId) override;
     std::shared_ptr<domain::Match> FindByTournamentIdAndName(const std::string_view& tournamentId, const std::string_view& name) override;
     void UpdateMatchScore(const std::string_view& matchId, const domain::Score& score) override;
+    std::vector<std::string> UpdateMatchScores(const std::vector<domain::Match>& matches) override;
     void Update(const std::string_view& matchId, const domain::Match& match) override;
     std::vector<std::string> CreateBulk(const std::vector<domain::Match>& matches) override;
     bool MatchesExistForTournament(const std::string_view& tournamentId) override;
@@ -4,27 +4,35 @@
 
 #ifndef RESTAPI_TEAMREPOSITORY_HPP
 #define RESTAPI_TEAMREPOSITORY_HPP
+#include <optional>
 #include <string>
+#include <vector>
 
 
-#include "IRepository.hpp"
+#include "ITeamRepository.hpp"
 #include "domain/Team.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 
 
-class TeamRepository : public IRepository<domain::Team, std::string_view> {
+class TeamRepository : public ITeamRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
 public:
 
 
     explicit TeamRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider);
 
-    std::vector<std::shared_ptr<domain::Team>> ReadAll() override;
+    std::vector<domain::Team> ReadAll() override;
+
+    std::string ReadAllAsJson() override;
 
     std::shared_ptr<domain::Team> ReadById(std::string_view id) override;
 
+    std::vector<domain::Team> ReadByIds(const std::vector<std::string> &ids) override;
+
     std::string_view Create(const domain::Team &entity) override;
 
+    std::vector<std::optional<std::string>> CreateMany(const std::vector<domain::Team> &teams) override;
+
     std::string_view Update(const domain::Team &entity) override;
 
     void Delete(std::string_view id) override;
@@ -19,7 +19,7 @@ public:
     std::string Create(const domain::Tournament& entity) override;
     std::string Update(const domain::Tournament& entity) override;
     void Delete(std::string id) override;
-    std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override;
+    std::vector<domain::Tournament> ReadAll() override;
 };
 
 #endif //TOURNAMENTS_TOURNAMENTREPOSITORY_HPP
\ No newline at end of file
@@ -0,0 +1,218 @@
+#ifndef TOURNAMENT_COMMON_BINARY_WRITER_HPP
+#define TOURNAMENT_COMMON_BINARY_WRITER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace serialization {
+    // Big endian helper shared by both formats.
+    inline void AppendBigEndian(std::string& out, std::uint64_t value, int bytes) {
+        for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>((value >> shift) & 0xFF));
+        }
+    }
+
+    // MessagePack, with the smallest representation for every value (same bytes nlohmann::json::to_msgpack emits).
+    struct MsgPackFormat {
+        static void ContainerHeader(std::string& out, bool isMap, std::uint32_t count) {
+            if (count <= 15) {
+                out.push_back(static_cast<char>((isMap ? 0x80 : 0x90) | count));
+            } else if (count <= 0xFFFF) {
+                out.push_back(static_cast<char>(isMap ? 0xDE : 0xDC));
+                AppendBigEndian(out, count, 2);
+            } else {
+                out.push_back(static_cast<char>(isMap ? 0xDF : 0xDD));
+                AppendBigEndian(out, count, 4);
+            }
+        }
+
+        static void String(std::string& out, std::string_view value) {
+            const std::size_t size = value.size();
+            if (size <= 31) {
+                out.push_back(static_cast<char>(0xA0 | size));
+            } else if (size <= 0xFF) {
+                out.push_back(static_cast<char>(0xD9));
+                AppendBigEndian(out, size, 1);
+            } else if (size <= 0xFFFF) {
+                out.push_back(static_cast<char>(0xDA));
+                AppendBigEndian(out, size, 2);
+            } else {
+                out.push_back(static_cast<char>(0xDB));
+                AppendBigEndian(out, size, 4);
+            }
+            out.append(value);
+        }
+
+        static void Int(std::string& out, std::int64_t value) {
+            if (value >= 0) {
+                const auto unsignedValue = static_cast<std::uint64_t>(value);
+                if (unsignedValue < 128) {
+                    out.push_back(static_cast<char>(unsignedValue));
+                } else if (unsignedValue <= 0xFF) {
+                    out.push_back(static_cast<char>(0xCC));
+                    AppendBigEndian(out, unsignedValue, 1);
+                } else if (unsignedValue <= 0xFFFF) {
+                    out.push_back(static_cast<char>(0xCD));
+                    AppendBigEndian(out, unsignedValue, 2);
+                } else if (unsignedValue <= 0xFFFFFFFF) {
+                    out.push_back(static_cast<char>(0xCE));
+                    AppendBigEndian(out, unsignedValue, 4);
+                } else {
+                    out.push_back(static_cast<char>(0xCF));
+                    AppendBigEndian(out, unsignedValue, 8);
+                }
+            } else if (value >= -32) {
+                out.push_back(static_cast<char>(value));
+            } else if (value >= INT8_MIN) {
+                out.push_back(static_cast<char>(0xD0));
+                AppendBigEndian(out, static_cast<std::uint64_t>(value), 1);
+            } else if (value >= INT16_MIN) {
+                out.push_back(static_cast<char>(0xD1));
+                AppendBigEndian(out, static_cast<std::uint64_t>(value), 2);
+            } else if (value >= INT32_MIN) {
+                out.push_back(static_cast<char>(0xD2));
+                AppendBigEndian(out, static_cast<std::uint64_t>(value), 4);
+            } else {
+                out.push_back(static_cast<char>(0xD3));
+                AppendBigEndian(out, static_cast<std::uint64_t>(value), 8);
+            }
+        }
+
+        static void Bool(std::string& out, bool value) { out.push_back(static_cast<char>(value ? 0xC3 : 0xC2)); }
+        static void Null(std::string& out) { out.push_back(static_cast<char>(0xC0)); }
+    };
+
+    // CBOR (RFC 8949) with definite lengths and minimal argument sizes (same bytes nlohmann::json::to_cbor emits).
+    struct CborFormat {
+        static void Head(std::string& out, std::uint8_t majorType, std::uint64_t argument) {
+            const auto major = static_cast<std::uint8_t>(majorType << 5);
+            if (argument < 24) {
+                out.push_back(static_cast<char>(major | argument));
+            } else if (argument <= 0xFF) {
+                out.push_back(static_cast<char>(major | 24));
+                AppendBigEndian(out, argument, 1);
+            } else if (argument <= 0xFFFF) {
+                out.push_back(static_cast<char>(major | 25));
+                AppendBigEndian(out, argument, 2);
+            } else if (argument <= 0xFFFFFFFF) {
+                out.push_back(static_cast<char>(major | 26));
+                AppendBigEndian(out, argument, 4);
+            } else {
+                out.push_back(static_cast<char>(major | 27));
+                AppendBigEndian(out, argument, 8);
+            }
+        }
+
+        static void ContainerHeader(std::string& out, bool isMap, std::uint32_t count) {
+            Head(out, isMap ? 5 : 4, count);
+        }
+
+        static void String(std::string& out, std::string_view value) {
+            Head(out, 3, value.size());
+            out.append(value);
+        }
+
+        static void Int(std::string& out, std::int64_t value) {
+            if (value >= 0) {
+                Head(out, 0, static_cast<std::uint64_t>(value));
+            } else {
+                Head(out, 1, static_cast<std::uint64_t>(-1 - value));
+            }
+        }
+
+        static void Bool(std::string& out, bool value) { out.push_back(static_cast<char>(value ? 0xF5 : 0xF4)); }
+        static void Null(std::string& out) { out.push_back(static_cast<char>(0xF6)); }
+    };
+
+    // Same interface as JsonWriter for length-prefixed binary formats. Element counts are not known up front,
+    // so each container gets a one byte header slot that is patched on close; only containers past the
+    // one byte size (15 entries for MessagePack, 23 for CBOR) shift their content to widen the header.
+    template<typename Format>
+    class BinaryWriter {
+        struct Frame {
+            std::size_t offset;
+            std::uint32_t count;
+            bool isMap;
+        };
+
+        std::string& out;
+        std::array<Frame, 64> frames{};
+        int depth = 0;
+        bool afterKey = false;
+
+        void Element() {
+            if (afterKey) {
+                afterKey = false;
+                return;
+            }
+            if (depth > 0) {
+                ++frames[depth - 1].count;
+            }
+        }
+
+        void Open(bool isMap) {
+            Element();
+            frames[depth++] = {out.size(), 0, isMap};
+            out.push_back('\0');
+        }
+
+        void Close() {
+            const Frame& frame = frames[--depth];
+            std::string header;
+            Format::ContainerHeader(header, frame.isMap, frame.count);
+            if (header.size() == 1) {
+                out[frame.offset] = header.front();
+            } else {
+                out.replace(frame.offset, 1, header);
+            }
+        }
+
+    public:
+        explicit BinaryWriter(std::string& out) : out(out) {}
+
+        BinaryWriter& BeginObject() { Open(true); return *this; }
+        BinaryWriter& EndObject() { Close(); return *this; }
+        BinaryWriter& BeginArray() { Open(false); return *this; }
+        BinaryWriter& EndArray() { Close(); return *this; }
+
+        // Map entries are counted per key, so the value that follows is not counted again.
+        BinaryWriter& Key(std::string_view key) {
+            Element();
+            Format::String(out, key);
+            afterKey = true;
+            return *this;
+        }
+
+        BinaryWriter& String(std::string_view value) {
+            Element();
+            Format::String(out, value);
+            return *this;
+        }
+
+        BinaryWriter& Int(std::int64_t value) {
+            Element();
+            Format::Int(out, value);
+            return *this;
+        }
+
+        BinaryWriter& Bool(bool value) {
+            Element();
+            Format::Bool(out, value);
+            return *this;
+        }
+
+        BinaryWriter& Null() {
+            Element();
+            Format::Null(out);
+            return *this;
+        }
+    };
+
+    using MsgPackWriter = BinaryWriter<MsgPackFormat>;
+    using CborWriter = BinaryWriter<CborFormat>;
+}
+
+#endif //TOURNAMENT_COMMON_BINARY_WRITER_HPP
@@ -0,0 +1,109 @@
+#ifndef TOURNAMENT_COMMON_DOCUMENT_DECODER_HPP
+#define TOURNAMENT_COMMON_DOCUMENT_DECODER_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "serialization/FieldTable.hpp"
+#include "serialization/JsonReader.hpp"
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Utilities.hpp"
+
+// Decodes stored documents straight into domain objects, generated from the same field tables as the
+// from_json overloads in Utilities.hpp.
+// Decode returns false whenever the input strays from the shapes we write ourselves (wrong types, missing
+// required keys, out of range numbers...); ParseDocument then falls back to nlohmann so results and errors
+// stay identical.
+namespace serialization {
+    inline bool ReadValue(JsonReader& reader, std::string& value) {
+        return reader.ReadString(value);
+    }
+
+    inline bool ReadValue(JsonReader& reader, int& value) {
+        return reader.ReadInt(value);
+    }
+
+    inline bool ReadValue(JsonReader& reader, domain::TournamentType& type) {
+        std::string name;
+        if (!reader.ReadString(name)) return false;
+        type = domain::fromString(name);
+        return true;
+    }
+
+    template<Described T>
+    bool Decode(JsonReader& reader, T& entity, bool lenient = false);
+
+    template<Described T>
+    bool ReadValue(JsonReader& reader, T& value) {
+        value = T();
+        return Decode(reader, value);
+    }
+
+    // Entries of a nested list are read leniently, as in from_json(json, std::vector<Team>&)
+    template<Described T>
+    bool ReadValue(JsonReader& reader, std::vector<T>& values) {
+        values.clear();
+        if (!reader.EnterArray()) return false;
+        while (reader.NextElement()) {
+            if (!Decode(reader, values.emplace_back(), true)) return false;
+        }
+        return !reader.Failed();
+    }
+
+    template<Described T>
+    bool Decode(JsonReader& reader, T& entity, bool lenient) {
+        if (!reader.EnterObject()) return false;
+        std::uint64_t seen = 0;
+        std::string_view key;
+        while (reader.NextMember(key)) {
+            bool ok = true;
+            const bool known = VisitField<T>(key, [&](const auto& field, std::size_t index) {
+                if (field.input == Input::IF_ARRAY && reader.Peek() != JsonType::ARRAY) {
+                    ok = reader.SkipValue();
+                    return;
+                }
+                ok = ReadValue(reader, field.access(entity));
+                seen |= std::uint64_t{1} << index;
+            });
+            if (!known) ok = reader.SkipValue();
+            if (!ok) return false;
+        }
+        if (reader.Failed()) return false;
+
+        bool complete = true;
+        std::size_t index = 0;
+        ForEachField<T>([&](const auto& field) {
+            if (!lenient && field.input == Input::REQUIRED && !(seen & (std::uint64_t{1} << index))) {
+                complete = false;
+            }
+            ++index;
+        });
+        return complete;
+    }
+
+    // Fast path only: true when the whole document was decoded into entity.
+    template<typename T>
+    bool DecodeDocument(std::string_view document, T& entity) {
+        JsonReader reader(document);
+        return Decode(reader, entity) && reader.AtEnd();
+    }
+
+    template<typename T>
+    T ParseDocument(std::string_view document) {
+#ifdef TOURNAMENTS_FAST_DOCUMENT_DECODE
+        T entity;
+        if (DecodeDocument(document, entity)) {
+            return entity;
+        }
+#endif
+        return nlohmann::json::parse(document).get<T>();
+    }
+}
+
+#endif //TOURNAMENT_COMMON_DOCUMENT_DECODER_HPP
@@ -0,0 +1,269 @@
+#ifndef TOURNAMENT_COMMON_ENCODING_HPP
+#define TOURNAMENT_COMMON_ENCODING_HPP
+
+#include <charconv>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "serialization/BinaryWriter.hpp"
+#include "serialization/FieldSet.hpp"
+#include "serialization/FieldTable.hpp"
+#include "serialization/JsonWriter.hpp"
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Utilities.hpp"
+
+namespace serialization {
+    template<typename Writer>
+    void Write(Writer& writer, const std::string& value) {
+        writer.String(value);
+    }
+
+    template<typename Writer>
+    void Write(Writer& writer, int value) {
+        writer.Int(value);
+    }
+
+    template<typename Writer>
+    void Write(Writer& writer, domain::TournamentType type) {
+        writer.String(domain::toString(type));
+    }
+
+    template<typename Writer, typename T>
+    void Write(Writer& writer, const std::shared_ptr<T>& entity);
+
+    template<typename Writer, typename T, typename Allocator>
+    void Write(Writer& writer, const std::vector<T, Allocator>& entities);
+
+    // Domain encoders, generated from the field tables against the writer interface (JsonWriter,
+    // MsgPackWriter, CborWriter). Tables are in key order, the order nlohmann uses, so JSON responses match
+    // the to_json overloads byte for byte.
+    template<typename Writer, Described T>
+    void Write(Writer& writer, const T& entity, const FieldSet<T>& fields) {
+        writer.BeginObject();
+        std::size_t index = 0;
+        ForEachField<T>([&](const auto& field) {
+            if (!fields.Contains(index++)) {
+                return;
+            }
+            const auto& value = field.access(entity);
+            if (field.output == Output::IF_NOT_EMPTY && IsEmpty(value)) {
+                return;
+            }
+            writer.Key(field.key);
+            Write(writer, value);
+        });
+        writer.EndObject();
+    }
+
+    template<typename Writer, Described T>
+    void Write(Writer& writer, const T& entity) {
+        Write(writer, entity, FieldSet<T>::All());
+    }
+
+    template<typename Writer, typename T>
+    void Write(Writer& writer, const std::shared_ptr<T>& entity) {
+        if (entity) {
+            Write(writer, *entity);
+        } else {
+            writer.Null();
+        }
+    }
+
+    template<typename Writer, typename T, typename Allocator>
+    void Write(Writer& writer, const std::vector<T, Allocator>& entities) {
+        writer.BeginArray();
+        for (const auto& entity : entities) {
+            Write(writer, entity);
+        }
+        writer.EndArray();
+    }
+
+    // Sparse list: only the members in fields, the response to ?fields=.
+    template<typename Writer, Described T, typename Allocator>
+    void Write(Writer& writer, const std::vector<T, Allocator>& entities, const FieldSet<T>& fields) {
+        writer.BeginArray();
+        for (const auto& entity : entities) {
+            Write(writer, entity, fields);
+        }
+        writer.EndArray();
+    }
+
+    // Serializes a list straight into out as JSON, reserving an estimate up front so large lists grow at most a few times.
+    template<typename T, typename Allocator>
+    void WriteList(std::string& out, const std::vector<T, Allocator>& entities, std::size_t bytesPerEntity = 192) {
+        out.reserve(out.size() + entities.size() * bytesPerEntity + 2);
+        JsonWriter writer(out);
+        Write(writer, entities);
+    }
+
+    enum class Encoding { JSON, MSGPACK, CBOR };
+
+    constexpr std::string_view ContentType(Encoding encoding) {
+        switch (encoding) {
+            case Encoding::MSGPACK: return "application/msgpack";
+            case Encoding::CBOR: return "application/cbor";
+            default: return "application/json";
+        }
+    }
+
+    namespace detail {
+        constexpr std::string_view Trim(std::string_view value) {
+            while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+            while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.remove_suffix(1);
+            return value;
+        }
+
+        constexpr bool EqualsIgnoreCase(std::string_view left, std::string_view right) {
+            if (left.size() != right.size()) return false;
+            for (std::size_t i = 0; i < left.size(); ++i) {
+                const char l = (left[i] >= 'A' && left[i] <= 'Z') ? static_cast<char>(left[i] + 32) : left[i];
+                if (l != right[i]) return false;
+            }
+            return true;
+        }
+
+        // Media type without parameters; application/x-msgpack is still common among msgpack clients.
+        constexpr std::optional<Encoding> FromMediaType(std::string_view mediaType) {
+            mediaType = Trim(mediaType.substr(0, mediaType.find(';')));
+            if (EqualsIgnoreCase(mediaType, "application/json")) return Encoding::JSON;
+            if (EqualsIgnoreCase(mediaType, "application/msgpack")
+                || EqualsIgnoreCase(mediaType, "application/x-msgpack")) return Encoding::MSGPACK;
+            if (EqualsIgnoreCase(mediaType, "application/cbor")) return Encoding::CBOR;
+            return std::nullopt;
+        }
+
+        // q parameter as thousandths, 1000 when absent.
+        inline int Quality(std::string_view mediaRange) {
+            for (std::size_t semicolon = mediaRange.find(';'); semicolon != std::string_view::npos;) {
+                const std::size_t next = mediaRange.find(';', semicolon + 1);
+                const std::string_view parameter = Trim(mediaRange.substr(semicolon + 1, next - semicolon - 1));
+                if (parameter.size() > 2 && (parameter[0] == 'q' || parameter[0] == 'Q') && parameter[1] == '=') {
+                    double quality = 0;
+                    const auto value = parameter.substr(2);
+                    if (std::from_chars(value.data(), value.data() + value.size(), quality).ec != std::errc{}) {
+                        return 0;
+                    }
+                    return static_cast<int>(quality * 1000);
+                }
+                semicolon = next;
+            }
+            return 1000;
+        }
+    }
+
+    // Picks the preferred supported encoding from an Accept header, JSON when nothing supported is listed
+    // (browsers send text/html,...,*/*), so unknown clients keep getting what they always got.
+    inline Encoding NegotiateEncoding(std::string_view accept) {
+        Encoding best = Encoding::JSON;
+        int bestQuality = 0;
+        while (!accept.empty()) {
+            const std::size_t comma = accept.find(',');
+            const std::string_view mediaRange = accept.substr(0, comma);
+            accept = comma == std::string_view::npos ? std::string_view{} : accept.substr(comma + 1);
+
+            const auto encoding = detail::FromMediaType(mediaRange);
+            const int quality = detail::Quality(mediaRange);
+            if (encoding && quality > bestQuality) {
+                best = *encoding;
+                bestQuality = quality;
+            }
+        }
+        return best;
+    }
+
+    // Content-Type of a request body; empty or unknown types are treated as JSON, as before.
+    inline Encoding EncodingOf(std::string_view contentType) {
+        return detail::FromMediaType(contentType).value_or(Encoding::JSON);
+    }
+
+    template<typename T>
+    void Encode(std::string& out, Encoding encoding, const T& value) {
+        switch (encoding) {
+            case Encoding::MSGPACK: {
+                MsgPackWriter writer(out);
+                Write(writer, value);
+                break;
+            }
+            case Encoding::CBOR: {
+                CborWriter writer(out);
+                Write(writer, value);
+                break;
+            }
+            default: {
+                JsonWriter writer(out);
+                Write(writer, value);
+            }
+        }
+    }
+
+    // Lists reserve from a per-entity estimate; binary encodings run about two thirds the size of JSON.
+    template<typename T, typename Allocator>
+    void Encode(std::string& out, Encoding encoding, const std::vector<T, Allocator>& entities, std::size_t bytesPerEntity) {
+        const std::size_t estimate = encoding == Encoding::JSON ? bytesPerEntity : bytesPerEntity * 2 / 3;
+        out.reserve(out.size() + entities.size() * estimate + 5);
+        Encode(out, encoding, entities);
+    }
+
+    // Same with only the members in fields; the estimate shrinks with the share of members kept.
+    template<Described T, typename Allocator>
+    void Encode(std::string& out, Encoding encoding, const std::vector<T, Allocator>& entities, std::size_t bytesPerEntity,
+                const FieldSet<T>& fields) {
+        if (fields.IsAll()) {
+            Encode(out, encoding, entities, bytesPerEntity);
+            return;
+        }
+        const std::size_t kept = bytesPerEntity * fields.Size() / FieldSet<T>::Count();
+        const std::size_t estimate = encoding == Encoding::JSON ? kept : kept * 2 / 3;
+        out.reserve(out.size() + entities.size() * estimate + 5);
+        switch (encoding) {
+            case Encoding::MSGPACK: {
+                MsgPackWriter writer(out);
+                Write(writer, entities, fields);
+                break;
+            }
+            case Encoding::CBOR: {
+                CborWriter writer(out);
+                Write(writer, entities, fields);
+                break;
+            }
+            default: {
+                JsonWriter writer(out);
+                Write(writer, entities, fields);
+            }
+        }
+    }
+
+    // Request bodies in a binary encoding are transcoded to JSON text so a single schema decoder serves every
+    // encoding. Returns nullopt when the body is not valid in the declared encoding.
+    inline std::optional<std::string> TranscodeToJson(std::string_view body, Encoding encoding) {
+        nlohmann::json document;
+        switch (encoding) {
+            case Encoding::MSGPACK:
+                document = nlohmann::json::from_msgpack(body, true, false);
+                break;
+            case Encoding::CBOR:
+                document = nlohmann::json::from_cbor(body, true, false);
+                break;
+            default:
+                return std::string(body);
+        }
+        if (document.is_discarded()) {
+            return std::nullopt;
+        }
+        try {
+            return document.dump();
+        } catch (const nlohmann::json::type_error&) {
+            // strings that are not valid UTF-8
+            return std::nullopt;
+        }
+    }
+}
+
+#endif //TOURNAMENT_COMMON_ENCODING_HPP
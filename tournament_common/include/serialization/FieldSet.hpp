@@ -0,0 +1,97 @@
+#ifndef TOURNAMENT_COMMON_FIELD_SET_HPP
+#define TOURNAMENT_COMMON_FIELD_SET_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "serialization/FieldTable.hpp"
+
+// The members of T a client asked for with ?fields=a,b (sparse fieldsets); bit i stands for entry i of
+// FieldTable<T>. Repositories push the set down into their query and the encoders skip the other members,
+// so an unrequested member is neither fetched, decoded nor written.
+namespace serialization {
+    template<Described T>
+    class FieldSet {
+        static constexpr std::size_t COUNT = std::tuple_size_v<std::remove_cvref_t<decltype(FieldTable<T>::fields)>>;
+        static_assert(COUNT < 64);
+        static constexpr std::uint64_t ALL = (std::uint64_t{1} << COUNT) - 1;
+
+        std::uint64_t bits = ALL;
+
+        constexpr explicit FieldSet(std::uint64_t bits) : bits(bits) {}
+
+    public:
+        constexpr FieldSet() = default;
+
+        static constexpr FieldSet All() { return FieldSet(ALL); }
+
+        static constexpr std::size_t Count() { return COUNT; }
+
+        // Comma separated keys, blanks around them ignored. Unexpected: the offending entry.
+        static constexpr std::expected<FieldSet, std::string> Parse(std::string_view list) {
+            std::uint64_t selected = 0;
+            while (!list.empty()) {
+                const auto comma = list.find(',');
+                std::string_view key = list.substr(0, comma);
+                list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+                while (!key.empty() && key.front() == ' ') key.remove_prefix(1);
+                while (!key.empty() && key.back() == ' ') key.remove_suffix(1);
+                if (key.empty()) {
+                    continue;
+                }
+                const bool known = VisitField<T>(key, [&](const auto&, std::size_t index) {
+                    selected |= std::uint64_t{1} << index;
+                });
+                if (!known) {
+                    return std::unexpected(std::string(key));
+                }
+            }
+            if (selected == 0) {
+                return std::unexpected(std::string{});
+            }
+            return FieldSet(selected);
+        }
+
+        [[nodiscard]] constexpr bool Contains(std::size_t index) const { return (bits >> index) & 1; }
+
+        [[nodiscard]] constexpr bool Contains(std::string_view key) const {
+            bool contained = false;
+            VisitField<T>(key, [&](const auto&, std::size_t index) { contained = Contains(index); });
+            return contained;
+        }
+
+        [[nodiscard]] constexpr bool IsAll() const { return bits == ALL; }
+
+        [[nodiscard]] constexpr int Size() const { return std::popcount(bits); }
+
+        // Postgres text[] literal of the keys left out, for "document - $n::text[]". Keys come from the field
+        // table, never from the request, so they need no quoting.
+        [[nodiscard]] std::string ExcludedKeysArray() const {
+            std::string array = "{";
+            std::size_t index = 0;
+            ForEachField<T>([&](const auto& field) {
+                if (!Contains(index++)) {
+                    if (array.size() > 1) {
+                        array += ',';
+                    }
+                    array += field.key;
+                }
+            });
+            array += '}';
+            return array;
+        }
+
+        constexpr bool operator==(const FieldSet&) const = default;
+
+        // Stable name of the set for cache keys and entity tags.
+        [[nodiscard]] std::string Name() const { return std::to_string(bits); }
+    };
+}
+
+#endif //TOURNAMENT_COMMON_FIELD_SET_HPP
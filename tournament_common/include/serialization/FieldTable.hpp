@@ -0,0 +1,76 @@
+#ifndef TOURNAMENT_COMMON_FIELD_TABLE_HPP
+#define TOURNAMENT_COMMON_FIELD_TABLE_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Compile-time description of a domain type: one entry per JSON member with its key, an accessor and how the
+// member is written and read. The nlohmann converters (Utilities.hpp), the streaming encoders (Encoding.hpp)
+// and the stored document decoder (DocumentDecoder.hpp) are all generated from the same table.
+namespace serialization {
+    // A member is either always written or left out while it holds an empty string.
+    enum class Output { ALWAYS, IF_NOT_EMPTY };
+
+    // REQUIRED members must be present unless the entity is read leniently (entries of a nested list);
+    // IF_ARRAY members are ignored when their value is not an array.
+    enum class Input { OPTIONAL, REQUIRED, IF_ARRAY };
+
+    // access takes the entity (const or not) and returns the member, by reference where one exists.
+    template<typename Access>
+    struct Field {
+        std::string_view key;
+        Access access;
+        Output output = Output::ALWAYS;
+        Input input = Input::OPTIONAL;
+    };
+
+    // Specialized per domain type with a static constexpr tuple of Field named fields.
+    template<typename T>
+    struct FieldTable;
+
+    template<typename T>
+    concept Described = requires { FieldTable<T>::fields; };
+
+    template<Described T, typename Visitor>
+    constexpr void ForEachField(Visitor&& visit) {
+        std::apply([&](const auto&... field) { (visit(field), ...); }, FieldTable<T>::fields);
+    }
+
+    // Calls visit(field, index) for the field named key, comparing against the static keys only;
+    // false when T has no such field.
+    template<Described T, typename Visitor>
+    constexpr bool VisitField(std::string_view key, Visitor&& visit) {
+        constexpr std::size_t COUNT = std::tuple_size_v<std::remove_cvref_t<decltype(FieldTable<T>::fields)>>;
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return ((std::get<I>(FieldTable<T>::fields).key == key
+                     && (visit(std::get<I>(FieldTable<T>::fields), I), true)) || ...);
+        }(std::make_index_sequence<COUNT>{});
+    }
+
+    template<typename Value>
+    constexpr bool IsEmpty(const Value& value) {
+        if constexpr (requires { value.empty(); }) {
+            return value.empty();
+        } else {
+            return false;
+        }
+    }
+
+    // Tables list their keys in ascending order, the order nlohmann writes object members in, so the
+    // streaming encoders emit the same bytes; checked with a static_assert next to every table.
+    template<Described T>
+    constexpr bool KeysSorted() {
+        bool sorted = true;
+        std::string_view previous;
+        ForEachField<T>([&](const auto& field) {
+            sorted = sorted && previous < field.key;
+            previous = field.key;
+        });
+        return sorted;
+    }
+}
+
+#endif //TOURNAMENT_COMMON_FIELD_TABLE_HPP
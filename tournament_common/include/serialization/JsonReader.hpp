@@ -0,0 +1,328 @@
+#ifndef TOURNAMENT_COMMON_JSON_READER_HPP
+#define TOURNAMENT_COMMON_JSON_READER_HPP
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace serialization {
+    enum class JsonType { OBJECT, ARRAY, STRING, NUMBER, BOOLEAN, NULL_VALUE, INVALID };
+
+    // Forward-only JSON reader working straight on the document bytes, without building a DOM.
+    // Every method returns false on malformed or unexpected input so callers can fall back to nlohmann.
+    // Strings are not UTF-8 validated: documents come from jsonb columns, which Postgres already validated.
+    class JsonReader {
+        std::string_view input;
+        std::size_t position = 0;
+        std::string keyBuffer;
+        bool firstEntry = false;
+        bool failed = false;
+
+        bool Fail() {
+            failed = true;
+            return false;
+        }
+
+        void SkipWhitespace() {
+            while (position < input.size()) {
+                const char c = input[position];
+                if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                    return;
+                }
+                ++position;
+            }
+        }
+
+        bool Consume(char expected) {
+            SkipWhitespace();
+            if (position < input.size() && input[position] == expected) {
+                ++position;
+                return true;
+            }
+            return false;
+        }
+
+        bool ConsumeLiteral(std::string_view literal) {
+            if (input.substr(position, literal.size()) != literal) {
+                return false;
+            }
+            position += literal.size();
+            return true;
+        }
+
+        bool ReadHex4(std::uint32_t& value) {
+            if (position + 4 > input.size()) {
+                return false;
+            }
+            value = 0;
+            for (int i = 0; i < 4; ++i) {
+                const char c = input[position++];
+                value <<= 4;
+                if (c >= '0' && c <= '9') value |= static_cast<std::uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') value |= static_cast<std::uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') value |= static_cast<std::uint32_t>(c - 'A' + 10);
+                else return false;
+            }
+            return true;
+        }
+
+        static void AppendUtf8(std::string& out, std::uint32_t codePoint) {
+            if (codePoint < 0x80) {
+                out.push_back(static_cast<char>(codePoint));
+            } else if (codePoint < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            } else if (codePoint < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            } else {
+                out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+
+        // Expects position right after the opening quote; leaves it after the closing quote.
+        bool DecodeString(std::string& out) {
+            out.clear();
+            while (position < input.size()) {
+                // copy the run of plain characters in one go
+                const std::size_t runStart = position;
+                while (position < input.size() && input[position] != '"' && input[position] != '\\'
+                       && static_cast<unsigned char>(input[position]) >= 0x20) {
+                    ++position;
+                }
+                out.append(input.data() + runStart, position - runStart);
+                if (position >= input.size()) {
+                    return false;
+                }
+                const char c = input[position++];
+                if (c == '"') {
+                    return true;
+                }
+                if (c != '\\' || position >= input.size()) {
+                    return false;
+                }
+                switch (input[position++]) {
+                    case '"': out.push_back('"'); break;
+                    case '\\': out.push_back('\\'); break;
+                    case '/': out.push_back('/'); break;
+                    case 'b': out.push_back('\b'); break;
+                    case 'f': out.push_back('\f'); break;
+                    case 'n': out.push_back('\n'); break;
+                    case 'r': out.push_back('\r'); break;
+                    case 't': out.push_back('\t'); break;
+                    case 'u': {
+                        std::uint32_t codePoint;
+                        if (!ReadHex4(codePoint)) {
+                            return false;
+                        }
+                        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                            std::uint32_t low;
+                            if (!ConsumeLiteral("\\u") || !ReadHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                                return false;
+                            }
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                        } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+                            return false;
+                        }
+                        AppendUtf8(out, codePoint);
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+            }
+            return false;
+        }
+
+        bool SkipNumber() {
+            const std::size_t start = position;
+            if (position < input.size() && input[position] == '-') ++position;
+            if (position >= input.size()) return false;
+            if (input[position] == '0') {
+                ++position;
+            } else if (input[position] >= '1' && input[position] <= '9') {
+                while (position < input.size() && input[position] >= '0' && input[position] <= '9') ++position;
+            } else {
+                return false;
+            }
+            if (position < input.size() && input[position] == '.') {
+                ++position;
+                const std::size_t digits = position;
+                while (position < input.size() && input[position] >= '0' && input[position] <= '9') ++position;
+                if (position == digits) return false;
+            }
+            if (position < input.size() && (input[position] == 'e' || input[position] == 'E')) {
+                ++position;
+                if (position < input.size() && (input[position] == '+' || input[position] == '-')) ++position;
+                const std::size_t digits = position;
+                while (position < input.size() && input[position] >= '0' && input[position] <= '9') ++position;
+                if (position == digits) return false;
+            }
+            return position > start;
+        }
+
+    public:
+        explicit JsonReader(std::string_view input) : input(input) {}
+
+        [[nodiscard]] JsonType Peek() {
+            SkipWhitespace();
+            if (position >= input.size()) {
+                return JsonType::INVALID;
+            }
+            switch (input[position]) {
+                case '{': return JsonType::OBJECT;
+                case '[': return JsonType::ARRAY;
+                case '"': return JsonType::STRING;
+                case 't': case 'f': return JsonType::BOOLEAN;
+                case 'n': return JsonType::NULL_VALUE;
+                default:
+                    return (input[position] == '-' || (input[position] >= '0' && input[position] <= '9'))
+                        ? JsonType::NUMBER : JsonType::INVALID;
+            }
+        }
+
+        bool EnterObject() {
+            firstEntry = true;
+            return Consume('{');
+        }
+
+        // Advances to the next member of the current object. Returns false at '}' or on malformed input,
+        // Failed() tells them apart. The key view stays valid until the next call.
+        bool NextMember(std::string_view& key) {
+            SkipWhitespace();
+            if (position >= input.size()) {
+                return Fail();
+            }
+            if (input[position] == '}') {
+                ++position;
+                firstEntry = false;
+                return false;
+            }
+            if (!firstEntry) {
+                if (input[position] != ',') {
+                    return Fail();
+                }
+                ++position;
+                SkipWhitespace();
+            }
+            firstEntry = false;
+            if (position >= input.size() || input[position] != '"') {
+                return Fail();
+            }
+            ++position;
+            const std::size_t keyStart = position;
+            while (position < input.size() && input[position] != '"' && input[position] != '\\'
+                   && static_cast<unsigned char>(input[position]) >= 0x20) {
+                ++position;
+            }
+            if (position < input.size() && input[position] == '"') {
+                key = input.substr(keyStart, position - keyStart);
+                ++position;
+            } else {
+                position = keyStart;
+                if (!DecodeString(keyBuffer)) {
+                    return Fail();
+                }
+                key = keyBuffer;
+            }
+            if (!Consume(':')) {
+                return Fail();
+            }
+            return true;
+        }
+
+        bool EnterArray() {
+            firstEntry = true;
+            return Consume('[');
+        }
+
+        // Same contract as NextMember, for array elements.
+        bool NextElement() {
+            SkipWhitespace();
+            if (position >= input.size()) {
+                return Fail();
+            }
+            if (input[position] == ']') {
+                ++position;
+                firstEntry = false;
+                return false;
+            }
+            if (!firstEntry) {
+                if (input[position] != ',') {
+                    return Fail();
+                }
+                ++position;
+            }
+            firstEntry = false;
+            return true;
+        }
+
+        [[nodiscard]] bool Failed() const {
+            return failed;
+        }
+
+        bool ReadString(std::string& out) {
+            return Consume('"') && DecodeString(out);
+        }
+
+        // Only plain JSON integers that fit in an int are accepted.
+        bool ReadInt(int& out) {
+            SkipWhitespace();
+            const std::size_t start = position;
+            if (!SkipNumber()) {
+                return false;
+            }
+            const std::string_view token = input.substr(start, position - start);
+            if (token.find_first_of(".eE") != std::string_view::npos) {
+                return false;
+            }
+            const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), out);
+            return error == std::errc{} && end == token.data() + token.size();
+        }
+
+        bool SkipValue() {
+            switch (Peek()) {
+                case JsonType::OBJECT: {
+                    EnterObject();
+                    std::string_view key;
+                    while (NextMember(key)) {
+                        if (!SkipValue()) return false;
+                    }
+                    return !failed;
+                }
+                case JsonType::ARRAY: {
+                    EnterArray();
+                    while (NextElement()) {
+                        if (!SkipValue()) return false;
+                    }
+                    return !failed;
+                }
+                case JsonType::STRING: {
+                    ++position;
+                    return DecodeString(keyBuffer);
+                }
+                case JsonType::NUMBER:
+                    return SkipNumber();
+                case JsonType::BOOLEAN:
+                    return ConsumeLiteral("true") || ConsumeLiteral("false");
+                case JsonType::NULL_VALUE:
+                    return ConsumeLiteral("null");
+                default:
+                    return false;
+            }
+        }
+
+        // True once the whole input was consumed (trailing whitespace allowed).
+        [[nodiscard]] bool AtEnd() {
+            SkipWhitespace();
+            return position == input.size();
+        }
+    };
+}
+
+#endif //TOURNAMENT_COMMON_JSON_READER_HPP
@@ -0,0 +1,124 @@
+#ifndef TOURNAMENT_COMMON_JSON_WRITER_HPP
+#define TOURNAMENT_COMMON_JSON_WRITER_HPP
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace serialization {
+    // Appends compact JSON to a caller owned buffer (e.g. a crow::response body), without building a DOM.
+    // Separators are handled by the writer; nesting is limited to 64 levels.
+    class JsonWriter {
+        std::string& out;
+        std::uint64_t hasEntries = 0;
+        int depth = 0;
+        bool afterKey = false;
+
+        void Separate() {
+            if (afterKey) {
+                afterKey = false;
+                return;
+            }
+            if (depth > 0) {
+                const std::uint64_t bit = std::uint64_t{1} << (depth - 1);
+                if (hasEntries & bit) {
+                    out.push_back(',');
+                }
+                hasEntries |= bit;
+            }
+        }
+
+        void Open(char bracket) {
+            Separate();
+            out.push_back(bracket);
+            ++depth;
+            hasEntries &= ~(std::uint64_t{1} << (depth - 1));
+        }
+
+        void Close(char bracket) {
+            --depth;
+            out.push_back(bracket);
+        }
+
+        void Escaped(std::string_view value) {
+            static constexpr char HEX[] = "0123456789abcdef";
+            out.push_back('"');
+            std::size_t runStart = 0;
+            for (std::size_t i = 0; i < value.size(); ++i) {
+                const auto c = static_cast<unsigned char>(value[i]);
+                if (c >= 0x20 && c != '"' && c != '\\') {
+                    continue;
+                }
+                out.append(value.data() + runStart, i - runStart);
+                runStart = i + 1;
+                switch (c) {
+                    case '"': out.append("\\\""); break;
+                    case '\\': out.append("\\\\"); break;
+                    case '\b': out.append("\\b"); break;
+                    case '\f': out.append("\\f"); break;
+                    case '\n': out.append("\\n"); break;
+                    case '\r': out.append("\\r"); break;
+                    case '\t': out.append("\\t"); break;
+                    default: {
+                        const char escape[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+                        out.append(escape, sizeof(escape));
+                    }
+                }
+            }
+            out.append(value.data() + runStart, value.size() - runStart);
+            out.push_back('"');
+        }
+
+    public:
+        explicit JsonWriter(std::string& out) : out(out) {}
+
+        JsonWriter& BeginObject() { Open('{'); return *this; }
+        JsonWriter& EndObject() { Close('}'); return *this; }
+        JsonWriter& BeginArray() { Open('['); return *this; }
+        JsonWriter& EndArray() { Close(']'); return *this; }
+
+        JsonWriter& Key(std::string_view key) {
+            Separate();
+            Escaped(key);
+            out.push_back(':');
+            afterKey = true;
+            return *this;
+        }
+
+        JsonWriter& String(std::string_view value) {
+            Separate();
+            Escaped(value);
+            return *this;
+        }
+
+        JsonWriter& Int(std::int64_t value) {
+            Separate();
+            char buffer[24];
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, result.ptr);
+            return *this;
+        }
+
+        JsonWriter& Bool(bool value) {
+            Separate();
+            out.append(value ? "true" : "false");
+            return *this;
+        }
+
+        JsonWriter& Null() {
+            Separate();
+            out.append("null");
+            return *this;
+        }
+
+        // A value that is already valid JSON, copied as is.
+        JsonWriter& Raw(std::string_view json) {
+            Separate();
+            out.append(json);
+            return *this;
+        }
+    };
+}
+
+#endif //TOURNAMENT_COMMON_JSON_WRITER_HPP
@@ -0,0 +1,220 @@
+#ifndef TOURNAMENT_COMMON_REQUEST_SCHEMA_HPP
+#define TOURNAMENT_COMMON_REQUEST_SCHEMA_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "serialization/JsonReader.hpp"
+
+// Single pass request decoding: the body is parsed, checked against a declarative per-endpoint schema and
+// written into the domain object at the same time, without a JSON DOM.
+namespace serialization {
+    inline constexpr std::string_view INVALID_JSON = "Invalid JSON format";
+
+    struct RequestError {
+        std::string field;
+        std::string message;
+    };
+
+    enum class Presence { REQUIRED, OPTIONAL, FORBIDDEN };
+
+    // One member of a request object. decode may fill error itself (nested values); when it leaves the
+    // message empty, message is reported for this field. Unknown members are skipped, like from_json does.
+    template<typename T>
+    struct FieldRule {
+        std::string_view name;
+        Presence presence;
+        bool (*decode)(JsonReader&, T&, RequestError&);
+        std::string_view message;
+    };
+
+    template<typename T>
+    using Schema = std::span<const FieldRule<T>>;
+
+    inline bool InvalidJson(RequestError& error) {
+        error.field.clear();
+        error.message = INVALID_JSON;
+        return false;
+    }
+
+    // Bodies come from clients, so unlike stored documents they are UTF-8 checked before decoding.
+    inline bool IsValidUtf8(std::string_view text) {
+        const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+        const std::size_t size = text.size();
+        std::size_t i = 0;
+        while (i < size) {
+            // skip ASCII eight bytes at a time
+            if (i + 8 <= size) {
+                std::uint64_t block;
+                std::memcpy(&block, data + i, sizeof(block));
+                if ((block & 0x8080808080808080ULL) == 0) {
+                    i += 8;
+                    continue;
+                }
+            }
+            const unsigned char c = data[i];
+            if (c < 0x80) {
+                ++i;
+                continue;
+            }
+            std::size_t length;
+            std::uint32_t codePoint;
+            if ((c & 0xE0) == 0xC0) { length = 2; codePoint = c & 0x1F; }
+            else if ((c & 0xF0) == 0xE0) { length = 3; codePoint = c & 0x0F; }
+            else if ((c & 0xF8) == 0xF0) { length = 4; codePoint = c & 0x07; }
+            else return false;
+            if (i + length > size) {
+                return false;
+            }
+            for (std::size_t j = 1; j < length; ++j) {
+                if ((data[i + j] & 0xC0) != 0x80) {
+                    return false;
+                }
+                codePoint = (codePoint << 6) | (data[i + j] & 0x3F);
+            }
+            // reject overlong forms, surrogates and values past U+10FFFF
+            constexpr std::uint32_t MIN_BY_LENGTH[] = {0, 0, 0x80, 0x800, 0x10000};
+            if (codePoint < MIN_BY_LENGTH[length] || codePoint > 0x10FFFF
+                || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+                return false;
+            }
+            i += length;
+        }
+        return true;
+    }
+
+    // Typed readers for field decoders: a value of another type is a schema error (message left empty so the
+    // rule reports it), a broken value is reported as invalid JSON.
+    inline bool ReadStringField(JsonReader& reader, std::string& out, RequestError& error) {
+        const JsonType type = reader.Peek();
+        if (type == JsonType::INVALID) return InvalidJson(error);
+        if (type != JsonType::STRING) return false;
+        return reader.ReadString(out) || InvalidJson(error);
+    }
+
+    inline bool ReadIntField(JsonReader& reader, int& out, RequestError& error) {
+        const JsonType type = reader.Peek();
+        if (type == JsonType::INVALID) return InvalidJson(error);
+        if (type != JsonType::NUMBER) return false;
+        return reader.ReadInt(out);
+    }
+
+    // Prepends the enclosing member (or array index) to the path of a nested error.
+    inline void PrefixField(RequestError& error, std::string_view prefix) {
+        if (error.message == INVALID_JSON) {
+            return;
+        }
+        if (error.field.empty()) {
+            error.field = prefix;
+        } else if (error.field.front() == '[') {
+            error.field.insert(0, prefix);
+        } else {
+            error.field.insert(0, std::string(prefix) + ".");
+        }
+    }
+
+    template<typename T>
+    bool DecodeObject(JsonReader& reader, T& entity, Schema<T> schema, RequestError& error) {
+        const JsonType type = reader.Peek();
+        if (type == JsonType::INVALID) return InvalidJson(error);
+        if (type != JsonType::OBJECT) return false;
+        reader.EnterObject();
+
+        std::uint64_t seen = 0;
+        std::string_view key;
+        while (reader.NextMember(key)) {
+            const auto rule = std::ranges::find(schema, key, &FieldRule<T>::name);
+            if (rule == schema.end()) {
+                if (!reader.SkipValue()) return InvalidJson(error);
+                continue;
+            }
+            if (rule->presence == Presence::FORBIDDEN) {
+                error = {std::string(rule->name), std::string(rule->message)};
+                return false;
+            }
+            if (!rule->decode(reader, entity, error)) {
+                if (error.message.empty()) {
+                    error.message = rule->message;
+                }
+                PrefixField(error, rule->name);
+                return false;
+            }
+            seen |= std::uint64_t{1} << (rule - schema.begin());
+        }
+        if (reader.Failed()) return InvalidJson(error);
+
+        for (std::size_t i = 0; i < schema.size(); ++i) {
+            if (schema[i].presence == Presence::REQUIRED && !(seen & (std::uint64_t{1} << i))) {
+                error = {std::string(schema[i].name), std::string(schema[i].message)};
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    bool DecodeArray(JsonReader& reader, std::vector<T>& entities, Schema<T> schema, RequestError& error) {
+        const JsonType type = reader.Peek();
+        if (type == JsonType::INVALID) return InvalidJson(error);
+        if (type != JsonType::ARRAY) return false;
+        reader.EnterArray();
+
+        entities.clear();
+        while (reader.NextElement()) {
+            if (!DecodeObject(reader, entities.emplace_back(), schema, error)) {
+                if (error.message.empty()) {
+                    error.message = "Array elements must be objects";
+                }
+                PrefixField(error, "[" + std::to_string(entities.size() - 1) + "]");
+                return false;
+            }
+        }
+        return !reader.Failed() || InvalidJson(error);
+    }
+
+    template<typename T>
+    std::expected<T, RequestError> DecodeRequest(std::string_view body, Schema<T> schema) {
+        RequestError error;
+        T entity;
+        JsonReader reader(body);
+        if (!IsValidUtf8(body)) {
+            InvalidJson(error);
+        } else if (!DecodeObject(reader, entity, schema, error)) {
+            if (error.message.empty()) {
+                error.message = "Request body must be a JSON object";
+            }
+        } else if (!reader.AtEnd()) {
+            InvalidJson(error);
+        } else {
+            return entity;
+        }
+        return std::unexpected(std::move(error));
+    }
+
+    template<typename T>
+    std::expected<std::vector<T>, RequestError> DecodeArrayRequest(std::string_view body, Schema<T> schema) {
+        RequestError error;
+        std::vector<T> entities;
+        JsonReader reader(body);
+        if (!IsValidUtf8(body)) {
+            InvalidJson(error);
+        } else if (!DecodeArray(reader, entities, schema, error)) {
+            if (error.message.empty()) {
+                error.message = "Request body must be a JSON array";
+            }
+        } else if (!reader.AtEnd()) {
+            InvalidJson(error);
+        } else {
+            return entities;
+        }
+        return std::unexpected(std::move(error));
+    }
+}
+
+#endif //TOURNAMENT_COMMON_REQUEST_SCHEMA_HPP
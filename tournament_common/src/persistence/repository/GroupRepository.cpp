@@ -3,11 +3,13 @@
 //
 
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
+#include "serialization/DocumentDecoder.hpp"
 #include  "persistence/repository/GroupRepository.hpp"
 
 GroupRepository::GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
 
-std::vector<std::shared_ptr<domain::Group>> GroupRepository::FindByTournamentId(const std::string_view& tournamentId) {
+std::vector<domain::Group> GroupRepository::FindByTournamentId(const std::string_view& tournamentId) {
     auto pooled = connectionProvider->Connection();
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
@@ -15,20 +17,29 @@ std::vector<std::shared_ptr<domain::Group>> GroupRepository::FindByTournamentId(
     pqxx::result result = tx.exec(pqxx::prepped{"select_groups_by_tournament"}, pqxx::params{tournamentId.data()});
     tx.commit();
 
-    std::vector<std::shared_ptr<domain::Group>> groups;
+    std::vector<domain::Group> groups;
+    groups.reserve(result.size());
     for(auto row : result){
-        nlohmann::json groupDocument = nlohmann::json::parse(row["document"].c_str());
-        auto group = std::make_shared<domain::Group>(groupDocument);
-        group->Id() = row["id"].c_str();
-
-        groups.push_back(group);
+        auto& group = groups.emplace_back(serialization::ParseDocument<domain::Group>(row["document"].view()));
+        group.Id() = row["id"].c_str();
     }
 
     return groups;
 }
 
+std::string GroupRepository::FindByTournamentIdAsJson(const std::string_view& tournamentId) {
+    auto pooled = connectionProvider->Connection();
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{"render_groups_by_tournament"}, pqxx::params{tournamentId.data()});
+    tx.commit();
+
+    return result[0]["body"].c_str();
+}
+
 std::shared_ptr<domain::Group> GroupRepository::ReadById(std::string id) {
-    return std::make_shared<domain::Group>();
+    return memory::MakeShared<domain::Group>();
 }
 
 std::string GroupRepository::Create (const domain::Group & entity) {
@@ -66,8 +77,8 @@ void GroupRepository::Delete(std::string id) {
     tx.commit();
 }
 
-std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadAll() {
-    std::vector<std::shared_ptr<domain::Group>> teams;
+std::vector<domain::Group> GroupRepository::ReadAll() {
+    std::vector<domain::Group> teams;
 
     auto pooled = connectionProvider->Connection();
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -76,8 +87,9 @@ std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadAll() {
     pqxx::result result{tx.exec("select id, document->>'name' as name from groups")};
     tx.commit();
 
+    teams.reserve(result.size());
     for(auto row : result){
-        teams.push_back(std::make_shared<domain::Group>(domain::Group{row["id"].c_str(), row["name"].c_str()}));
+        teams.push_back(domain::Group{row["id"].c_str(), row["name"].c_str()});
     }
 
     return teams;
@@ -93,8 +105,7 @@ std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndGroupId(con
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json groupDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    auto group = std::make_shared<domain::Group>(groupDocument);
+    auto group = memory::MakeShared<domain::Group>(serialization::ParseDocument<domain::Group>(result[0]["document"].view()));
     group->Id() = result[0]["id"].c_str();
 
     return group;
@@ -110,38 +121,38 @@ std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndTeamId(cons
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json groupDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    std::shared_ptr<domain::Group> group = std::make_shared<domain::Group>(groupDocument);
+    std::shared_ptr<domain::Group> group = memory::MakeShared<domain::Group>(serialization::ParseDocument<domain::Group>(result[0]["document"].view()));
     group->Id() = result[0]["id"].c_str();
 
     return group;
 }
 
-std::shared_ptr<domain::Group> GroupRepository::FindByGroupIdAndTeamId(const std::string_view& groupId, const std::string_view& teamId) {
+std::vector<std::string> GroupRepository::FindTeamIdsInGroup(const std::string_view& groupId, const std::vector<std::string>& teamIds) {
+    const nlohmann::json ids = teamIds;
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"select_group_by_group_id_team_id"}, pqxx::params{groupId.data(), teamId.data()});
+    const pqxx::result result = tx.exec(pqxx::prepped{"select_group_team_ids_in"}, pqxx::params{groupId.data(), ids.dump()});
     tx.commit();
-    
-    if (result.empty()) {
-        return nullptr;
+
+    std::vector<std::string> members;
+    members.reserve(result.size());
+    for (const auto row : result) {
+        members.emplace_back(row["id"].c_str());
     }
-    
-    nlohmann::json groupDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    std::shared_ptr<domain::Group> group = std::make_shared<domain::Group>(groupDocument);
-    group->Id() = result[0]["id"].c_str();
-    
-    return group;
+    return members;
 }
 
-void GroupRepository::UpdateGroupAddTeam(const std::string_view& groupId, const std::shared_ptr<domain::Team> & team) {
-    nlohmann::json teamDocument = team;
+void GroupRepository::UpdateGroupAddTeams(const std::string_view& groupId, const std::vector<domain::Team>& teams) {
+    nlohmann::json teamDocuments = nlohmann::json::array();
+    for (const auto& team : teams) {
+        teamDocuments.push_back(team);
+    }
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"update_group_add_team"}, pqxx::params{groupId.data(), teamDocument.dump()});
+    const pqxx::result result = tx.exec(pqxx::prepped{"update_group_add_teams"}, pqxx::params{groupId.data(), teamDocuments.dump()});
     tx.commit();
-}
\ No newline at end of file
+}
@@ -1,25 +1,85 @@
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
+#include "serialization/DocumentDecoder.hpp"
 #include  "persistence/repository/MatchRepository.hpp"
 
 MatchRepository::MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
 
-std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentId(const std::string_view& tournamentId) {
+std::pmr::vector<domain::Match> MatchRepository::FindByTournamentId(const std::string_view& tournamentId,
+                                                               const serialization::FieldSet<domain::Match>& fields) {
     auto pooled = connectionProvider->Connection();
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_matches_by_tournament"}, pqxx::params{tournamentId.data()});
+    // a projection drops the unrequested members in the database, so they are neither sent nor decoded
+    pqxx::result result = fields.IsAll()
+        ? tx.exec(pqxx::prepped{"select_matches_by_tournament"}, pqxx::params{tournamentId.data()})
+        : tx.exec(pqxx::prepped{"select_matches_fields_by_tournament"}, pqxx::params{tournamentId.data(), fields.ExcludedKeysArray()});
     tx.commit();
 
-    std::vector<std::shared_ptr<domain::Match>> matches;
+    const bool withId = fields.Contains("id");
+    auto matches = memory::MakeList<domain::Match>(result.size());
     for(auto row : result){
-        nlohmann::json matchDocument = nlohmann::json::parse(row["document"].c_str());
-        auto match = std::make_shared<domain::Match>(matchDocument);
-        match->Id() = row["id"].c_str();
+        auto& match = matches.emplace_back(serialization::ParseDocument<domain::Match>(row["document"].view()));
+        if (withId) {
+            match.Id() = row["id"].c_str();
+        }
+    }
+
+    return matches;
+}
+
+std::string MatchRepository::FindByTournamentIdAsJson(const std::string_view& tournamentId,
+                                                      const serialization::FieldSet<domain::Match>& fields) {
+    auto pooled = connectionProvider->Connection();
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = fields.IsAll()
+        ? tx.exec(pqxx::prepped{"render_matches_by_tournament"}, pqxx::params{tournamentId.data()})
+        : tx.exec(pqxx::prepped{"render_matches_fields_by_tournament"}, pqxx::params{tournamentId.data(), fields.ExcludedKeysArray()});
+    tx.commit();
 
-        matches.push_back(match);
+    return result[0]["body"].c_str();
+}
+
+std::optional<std::string> MatchRepository::FindVersionByTournamentId(const std::string_view& tournamentId) {
+    auto pooled = connectionProvider->Connection();
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{"version_matches_by_tournament"}, pqxx::params{tournamentId.data()});
+    tx.commit();
+
+    if (result.empty()) {
+        return std::nullopt;
     }
+    return result[0]["version"].c_str();
+}
 
+std::optional<std::pmr::vector<domain::BracketMatch>> MatchRepository::FindBracketByTournamentId(const std::string_view& tournamentId) {
+    auto pooled = connectionProvider->Connection();
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{"select_bracket_by_tournament"}, pqxx::params{tournamentId.data()});
+    tx.commit();
+
+    if (result.empty()) {
+        return std::nullopt;
+    }
+    // c_str() reads null columns (teams not decided yet) as empty strings
+    auto matches = memory::MakeList<domain::BracketMatch>(result.size());
+    for (const auto& row : result) {
+        if (row["id"].is_null()) {
+            continue;
+        }
+        auto& match = matches.emplace_back();
+        match.id = row["id"].c_str();
+        match.name = row["name"].c_str();
+        match.home = {row["home_team_id"].c_str(), row["home_team_name"].c_str(), row["home_group_name"].c_str(), row["home_score"].as<int>()};
+        match.visitor = {row["visitor_team_id"].c_str(), row["visitor_team_name"].c_str(), row["visitor_group_name"].c_str(), row["visitor_score"].as<int>()};
+    }
     return matches;
 }
 
@@ -33,8 +93,7 @@ std::shared_ptr<domain::Match> MatchRepository::FindByTournamentIdAndMatchId(con
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json matchDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    auto match = std::make_shared<domain::Match>(matchDocument);
+    auto match = memory::MakeShared<domain::Match>(serialization::ParseDocument<domain::Match>(result[0]["document"].view()));
     match->Id() = result[0]["id"].c_str();
 
     return match;
@@ -50,6 +109,26 @@ void MatchRepository::UpdateMatchScore(const std::string_view& matchId, const do
     tx.commit();
 }
 
+std::vector<std::string> MatchRepository::UpdateMatchScores(const std::vector<domain::Match>& matches) {
+    nlohmann::json updates = nlohmann::json::array();
+    for (const auto& match : matches) {
+        updates.push_back({{"id", match.Id()}, {"tournamentId", match.TournamentId()}, {"score", match.MatchScore()}});
+    }
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{"update_match_scores"}, pqxx::params{updates.dump()});
+    tx.commit();
+
+    std::vector<std::string> updated;
+    updated.reserve(result.size());
+    for (const auto row : result) {
+        updated.emplace_back(row["id"].c_str());
+    }
+    return updated;
+}
+
 std::vector<std::string> MatchRepository::CreateBulk(const std::vector<domain::Match>& matches) {
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -89,8 +168,7 @@ std::shared_ptr<domain::Match> MatchRepository::FindByTournamentIdAndName(const
         return nullptr;
     }
     
-    nlohmann::json matchDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    auto match = std::make_shared<domain::Match>(matchDocument);
+    auto match = memory::MakeShared<domain::Match>(serialization::ParseDocument<domain::Match>(result[0]["document"].view()));
     match->Id() = result[0]["id"].c_str();
 
     return match;
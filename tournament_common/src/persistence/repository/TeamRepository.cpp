@@ -4,14 +4,16 @@
 #include <iostream>
 
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
+#include "serialization/DocumentDecoder.hpp"
 #include "persistence/repository/TeamRepository.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
 
 TeamRepository::TeamRepository(
     std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
 
-std::vector<std::shared_ptr<domain::Team>> TeamRepository::ReadAll() {
-  std::vector<std::shared_ptr<domain::Team>> teams;
+std::vector<domain::Team> TeamRepository::ReadAll() {
+  std::vector<domain::Team> teams;
 
   auto pooled = connectionProvider->Connection();
   auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
@@ -21,14 +23,25 @@ std::vector<std::shared_ptr<domain::Team>> TeamRepository::ReadAll() {
       tx.exec("select id, document->>'name' as name from teams")};
   tx.commit();
 
+  teams.reserve(result.size());
   for (auto row : result) {
-    teams.push_back(std::make_shared<domain::Team>(
-        domain::Team{row["id"].c_str(), row["name"].c_str()}));
+    teams.push_back(domain::Team{row["id"].c_str(), row["name"].c_str()});
   }
 
   return teams;
 }
 
+std::string TeamRepository::ReadAllAsJson() {
+  auto pooled = connectionProvider->Connection();
+  auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
+
+  pqxx::work tx(*(connection->connection));
+  const pqxx::result result = tx.exec(pqxx::prepped{"render_teams"});
+  tx.commit();
+
+  return result[0]["body"].c_str();
+}
+
 std::shared_ptr<domain::Team> TeamRepository::ReadById(std::string_view id) {
   auto pooled = connectionProvider->Connection();
   const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -40,13 +53,29 @@ std::shared_ptr<domain::Team> TeamRepository::ReadById(std::string_view id) {
     return nullptr;
   }
 
-  nlohmann::json rowTeam = nlohmann::json::parse(result.at(0)["document"].c_str());
-  auto team = std::make_shared<domain::Team>(rowTeam);
+  auto team = memory::MakeShared<domain::Team>(serialization::ParseDocument<domain::Team>(result.at(0)["document"].view()));
   team->Id = result.at(0)["id"].c_str();
 
   return team;
 }
 
+std::vector<domain::Team> TeamRepository::ReadByIds(const std::vector<std::string> &ids) {
+  const nlohmann::json idList = ids;
+  auto pooled = connectionProvider->Connection();
+  auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
+
+  pqxx::work tx(*(connection->connection));
+  const pqxx::result result = tx.exec(pqxx::prepped{"select_teams_by_ids"}, pqxx::params{idList.dump()});
+  tx.commit();
+
+  std::vector<domain::Team> teams;
+  teams.reserve(result.size());
+  for (const auto row : result) {
+    teams.push_back(domain::Team{row["id"].c_str(), row["name"].c_str()});
+  }
+  return teams;
+}
+
 std::string_view TeamRepository::Create(const domain::Team &entity) {
   auto pooled = connectionProvider->Connection();
   auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
@@ -59,6 +88,26 @@ std::string_view TeamRepository::Create(const domain::Team &entity) {
   return result[0]["id"].c_str();
 }
 
+std::vector<std::optional<std::string>> TeamRepository::CreateMany(const std::vector<domain::Team> &teams) {
+  auto pooled = connectionProvider->Connection();
+  auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
+  nlohmann::json documents = nlohmann::json::array();
+  for (const auto& team : teams) {
+    documents.push_back(team);
+  }
+
+  pqxx::work tx(*(connection->connection));
+  const pqxx::result result = tx.exec(pqxx::prepped{"insert_teams"}, pqxx::params{documents.dump()});
+  tx.commit();
+
+  std::vector<std::optional<std::string>> ids;
+  ids.reserve(result.size());
+  for (const auto row : result) {
+    ids.push_back(row["id"].is_null() ? std::nullopt : std::optional<std::string>(row["id"].c_str()));
+  }
+  return ids;
+}
+
 std::string_view TeamRepository::Update(const domain::Team &entity) {
   auto pooled = connectionProvider->Connection();
   auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
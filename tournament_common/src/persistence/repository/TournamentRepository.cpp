@@ -9,6 +9,8 @@
 
 #include "persistence/repository/TournamentRepository.hpp"
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
+#include "serialization/DocumentDecoder.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
 
 TournamentRepository::TournamentRepository(std::shared_ptr<IDbConnectionProvider> connection)
@@ -26,8 +28,7 @@ std::shared_ptr<domain::Tournament> TournamentRepository::ReadById(const std::st
         return nullptr;
     }
 
-    nlohmann::json rowTournament = nlohmann::json::parse(result.at(0)["document"].c_str());
-    auto tournament = std::make_shared<domain::Tournament>(rowTournament);
+    auto tournament = memory::MakeShared<domain::Tournament>(serialization::ParseDocument<domain::Tournament>(result.at(0)["document"].view()));
     tournament->Id() = std::string(result.at(0)["id"].c_str());
 
     return tournament;
@@ -68,8 +69,8 @@ void TournamentRepository::Delete(const std::string id) {
     tx.commit();
 }
 
-std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadAll() {
-    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+std::vector<domain::Tournament> TournamentRepository::ReadAll() {
+    std::vector<domain::Tournament> tournaments;
 
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -78,12 +79,10 @@ std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadAll()
     const pqxx::result result{tx.exec("select id, document from tournaments")};
     tx.commit();
 
+    tournaments.reserve(result.size());
     for (auto row : result) {
-        nlohmann::json rowTournament = nlohmann::json::parse(row["document"].c_str());
-        auto tournament = std::make_shared<domain::Tournament>(rowTournament);
-        tournament->Id() = std::string(row["id"].c_str());
-
-        tournaments.push_back(tournament);
+        auto& tournament = tournaments.emplace_back(serialization::ParseDocument<domain::Tournament>(row["document"].view()));
+        tournament.Id() = std::string(row["id"].c_str());
     }
 
     return tournaments;
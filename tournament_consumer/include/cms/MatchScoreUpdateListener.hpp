@@ -35,6 +35,17 @@ inline void MatchScoreUpdateListener::processMessage(const std::string& message)
 
     try {
         nlohmann::json json = nlohmann::json::parse(message);
+        // queued submissions arrive as one array per batch, in the order they were accepted
+        if (json.is_array()) {
+            for (const auto& entry : json) {
+                try {
+                    matchDelegate->ProcessScoreUpdate(entry.get<domain::ScoreUpdateEvent>());
+                } catch (const std::exception& e) {
+                    std::cout << "[MatchScoreUpdateListener] ERROR: " << e.what() << std::endl;
+                }
+            }
+            return;
+        }
         domain::ScoreUpdateEvent event = json.get<domain::ScoreUpdateEvent>();
         
         matchDelegate->ProcessScoreUpdate(event);
@@ -5,8 +5,10 @@
 #ifndef CONSUMER_MATCHDELEGATE_HPP
 #define CONSUMER_MATCHDELEGATE_HPP
 
+#include <charconv>
 #include <memory>
 #include <iostream>
+#include <string_view>
 
 #include "event/TeamAddEvent.hpp"
 #include "event/ScoreUpdateEvent.hpp"
@@ -26,16 +28,17 @@ public:
     void ProcessScoreUpdate(const domain::ScoreUpdateEvent& scoreUpdateEvent);
 
 private:
-    std::string GetWinnerNextMatch(const std::string& matchName);
-    std::string GetLoserNextMatch(const std::string& matchName);
-    void AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, const std::string& teamId, bool isHome);
+    static int MatchNumber(std::string_view matchName);
+    std::string GetWinnerNextMatch(std::string_view matchName);
+    std::string GetLoserNextMatch(std::string_view matchName);
+    void AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, std::string_view teamId, bool isHome);
 };
 
 inline MatchDelegate::MatchDelegate(const std::shared_ptr<IMatchRepository> &matchRepository, const std::shared_ptr<GroupRepository> &groupRepository)
 : matchRepository(matchRepository), groupRepository(groupRepository), bracketGenerator(std::make_unique<BracketGenerator>()) {}
 
 inline void MatchDelegate::ProcessTeamAddition(const domain::TeamAddEvent& teamAddEvent) {
-    std::cout << "[MatchDelegate] Processing team addition for tournament: " << teamAddEvent.tournamentId << std::endl;
+    std::cout << "[MatchDelegate] Processing addition of " << teamAddEvent.teamIds.size() << " teams for tournament: " << teamAddEvent.tournamentId << std::endl;
     
     auto group = groupRepository->FindByTournamentIdAndGroupId(teamAddEvent.tournamentId, teamAddEvent.groupId);
     if (group != nullptr && group->Teams().size() == 32) {
@@ -90,7 +93,7 @@ inline void MatchDelegate::ProcessScoreUpdate(const domain::ScoreUpdateEvent& sc
     }
     
     // Determine winner and loser
-    std::string winnerTeamId, loserTeamId;
+    std::string_view winnerTeamId, loserTeamId;
     if (scoreUpdateEvent.homeTeamScore > scoreUpdateEvent.visitorTeamScore) {
         winnerTeamId = match->HomeTeamId();
         loserTeamId = match->VisitorTeamId();
@@ -132,10 +135,19 @@ inline void MatchDelegate::ProcessScoreUpdate(const domain::ScoreUpdateEvent& sc
     }
 }
 
-inline std::string MatchDelegate::GetWinnerNextMatch(const std::string& matchName) {
+inline int MatchDelegate::MatchNumber(std::string_view matchName) {
+    int matchNum = -1;
+    std::from_chars(matchName.data() + 1, matchName.data() + matchName.size(), matchNum);
+    return matchNum;
+}
+
+inline std::string MatchDelegate::GetWinnerNextMatch(std::string_view matchName) {
+    if (matchName.empty()) {
+        return "";
+    }
     // Winners bracket advancement (W0-W30)
     if (matchName[0] == 'W') {
-        int matchNum = std::stoi(matchName.substr(1));
+        int matchNum = MatchNumber(matchName);
         
         // Round 1 (W0-W15) -> Round 2 (W16-W23)
         if (matchNum >= 0 && matchNum <= 15) {
@@ -161,7 +173,7 @@ inline std::string MatchDelegate::GetWinnerNextMatch(const std::string& matchNam
     
     // Losers bracket advancement (L0-L29)
     if (matchName[0] == 'L') {
-        int matchNum = std::stoi(matchName.substr(1));
+        int matchNum = MatchNumber(matchName);
         
         // L0-L7 -> L8-L15
         if (matchNum >= 0 && matchNum <= 7) {
@@ -212,10 +224,13 @@ inline std::string MatchDelegate::GetWinnerNextMatch(const std::string& matchNam
     return "";
 }
 
-inline std::string MatchDelegate::GetLoserNextMatch(const std::string& matchName) {
+inline std::string MatchDelegate::GetLoserNextMatch(std::string_view matchName) {
+    if (matchName.empty()) {
+        return "";
+    }
     // Winners bracket losers go to losers bracket
     if (matchName[0] == 'W') {
-        int matchNum = std::stoi(matchName.substr(1));
+        int matchNum = MatchNumber(matchName);
         
         // W0-W15 losers -> L0-L7 (pair them up)
         if (matchNum >= 0 && matchNum <= 15) {
@@ -259,7 +274,7 @@ inline std::string MatchDelegate::GetLoserNextMatch(const std::string& matchName
     return "";
 }
 
-inline void MatchDelegate::AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, const std::string& teamId, bool isHome) {
+inline void MatchDelegate::AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, std::string_view teamId, bool isHome) {
     auto nextMatch = matchRepository->FindByTournamentIdAndName(tournamentId, nextMatchName);
     if (!nextMatch) {
         std::cout << "[MatchDelegate] ERROR: Next match " << nextMatchName << " not found" << std::endl;
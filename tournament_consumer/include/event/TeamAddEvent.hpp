@@ -5,19 +5,27 @@
 #ifndef TOURNAMENTS_GROUPADDEVENT_HPP
 #define TOURNAMENTS_GROUPADDEVENT_HPP
 #include <string>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 namespace domain {
+    // One event per request that added teams to a group, listing all of them. Messages published before the
+    // aggregated form carry a single "teamId" (possibly empty) and are still accepted.
     struct TeamAddEvent {
         std::string tournamentId;
         std::string groupId;
-        std::string teamId;
+        std::vector<std::string> teamIds;
     };
 
     inline void from_json(const nlohmann::json &json, TeamAddEvent &teamAddEvent) {
         json.at("tournamentId").get_to(teamAddEvent.tournamentId);
         json.at("groupId").get_to(teamAddEvent.groupId);
-        json.at("teamId").get_to(teamAddEvent.teamId);
+        teamAddEvent.teamIds.clear();
+        if (json.contains("teamIds")) {
+            json.at("teamIds").get_to(teamAddEvent.teamIds);
+        } else if (json.contains("teamId") && !json.at("teamId").get_ref<const std::string&>().empty()) {
+            teamAddEvent.teamIds.push_back(json.at("teamId").get<std::string>());
+        }
     }
 }
 #endif //TOURNAMENTS_GROUPADDEVENT_HPP
@@ -5,11 +5,13 @@
 #ifndef SERVICE_MESSAGE_PRODUCER_HPP
 #define SERVICE_MESSAGE_PRODUCER_HPP
 
+#include <chrono>
 #include <string_view>
 #include <memory>
 
 #include "IQueueMessageProducer.hpp"
 #include "cms/ConnectionManager.hpp"
+#include "metrics/Metrics.hpp"
 
 class QueueMessageProducer: public IQueueMessageProducer {
     std::shared_ptr<ConnectionManager> connectionManager;
@@ -17,6 +19,7 @@ public:
     explicit QueueMessageProducer(const std::shared_ptr<ConnectionManager>& connectionManager) : connectionManager(connectionManager){}
 
     void SendMessage(const std::string_view& message, const std::string_view& queue) override {
+        const auto start = std::chrono::steady_clock::now();
         auto session = connectionManager->CreateSession();
         const auto destination = std::unique_ptr<cms::Destination>(session->createQueue(queue.data()));
         auto producer = std::unique_ptr<cms::MessageProducer>(session->createProducer(destination.get()));
@@ -24,6 +27,8 @@ public:
 
         const auto brokerMessage = std::unique_ptr<cms::TextMessage>(session->createTextMessage(message.data()));
         producer->send(brokerMessage.get());
+        metrics::Registry::Instance().ObserveBrokerSend(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
     }
 };
 
@@ -0,0 +1,208 @@
+#ifndef RESTAPI_SCORE_SUBMISSION_QUEUE_HPP
+#define RESTAPI_SCORE_SUBMISSION_QUEUE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "delegate/IMatchDelegate.hpp"
+#include "domain/Match.hpp"
+#include "exception/Error.hpp"
+
+// Score submissions accepted with 202 (PATCH ... Prefer: respond-async). Submit only appends to a bounded
+// queue; one background worker drains it in batches through IMatchDelegate::UpdateMatchScores, so a batch
+// costs one write and one broker message however many scores it holds. A single worker keeps submissions for
+// the same match in the order they were accepted.
+//
+// Each submission is an operation that GET /operations/{id} reports on; finished operations are kept for
+// RETENTION. Close (and the destructor) processes whatever is still queued before returning.
+namespace concurrency {
+    enum class OperationStatus { PENDING, SUCCEEDED, FAILED };
+
+    struct Operation {
+        std::string id;
+        std::string tournamentId;
+        std::string matchId;
+        OperationStatus status = OperationStatus::PENDING;
+        std::optional<Error> error;
+        std::chrono::steady_clock::time_point finishedAt;
+    };
+
+    // Random (version 4) UUID, so operation ids look like every other id in the API.
+    inline std::string NewOperationId() {
+        thread_local std::mt19937_64 generator{std::random_device{}()};
+        std::uint64_t high = generator();
+        std::uint64_t low = generator();
+        high = (high & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;
+        low = (low & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
+
+        constexpr char HEX[] = "0123456789abcdef";
+        std::string id;
+        id.reserve(36);
+        for (int nibble = 15; nibble >= 0; --nibble) {
+            id.push_back(HEX[(high >> (nibble * 4)) & 0xF]);
+            if (nibble == 8 || nibble == 4) id.push_back('-');
+        }
+        id.push_back('-');
+        for (int nibble = 15; nibble >= 0; --nibble) {
+            id.push_back(HEX[(low >> (nibble * 4)) & 0xF]);
+            if (nibble == 12) id.push_back('-');
+        }
+        return id;
+    }
+
+    class ScoreSubmissionQueue {
+    public:
+        static constexpr auto RETENTION = std::chrono::minutes(10);
+
+    private:
+        struct Submission {
+            std::string operationId;
+            domain::Match match;
+        };
+
+        std::shared_ptr<IMatchDelegate> matchDelegate;
+        const std::size_t capacity;
+        const std::size_t batchSize;
+
+        mutable std::mutex mutex;
+        std::condition_variable available;
+        std::deque<Submission> pending;
+        std::unordered_map<std::string, Operation> operations;
+        std::deque<std::string> finishedOrder;
+        bool stopping = false;
+        // last member: started once everything above exists, joined before it is destroyed
+        std::jthread worker;
+
+        // Up to batchSize submissions with distinct match ids: a later score for a match already in the batch
+        // waits for the next one.
+        std::vector<Submission> TakeBatch() {
+            std::vector<Submission> batch;
+            for (auto it = pending.begin(); it != pending.end() && batch.size() < batchSize;) {
+                const bool repeated = std::ranges::any_of(batch, [&](const Submission& taken) {
+                    return taken.match.Id() == it->match.Id();
+                });
+                if (repeated) {
+                    break;
+                }
+                batch.push_back(std::move(*it));
+                it = pending.erase(it);
+            }
+            return batch;
+        }
+
+        void Finish(const std::vector<Submission>& batch, const std::vector<std::expected<std::string, Error>>& results) {
+            const auto now = std::chrono::steady_clock::now();
+            std::lock_guard lock(mutex);
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                auto operation = operations.find(batch[i].operationId);
+                if (operation == operations.end()) {
+                    continue;
+                }
+                const bool ok = i < results.size() && results[i].has_value();
+                operation->second.status = ok ? OperationStatus::SUCCEEDED : OperationStatus::FAILED;
+                if (!ok) {
+                    operation->second.error = i < results.size() ? results[i].error() : Error::UNKNOWN_ERROR;
+                }
+                operation->second.finishedAt = now;
+                finishedOrder.push_back(batch[i].operationId);
+            }
+            while (!finishedOrder.empty() && now - operations[finishedOrder.front()].finishedAt > RETENTION) {
+                operations.erase(finishedOrder.front());
+                finishedOrder.pop_front();
+            }
+        }
+
+        void Run() {
+            while (true) {
+                std::vector<Submission> batch;
+                {
+                    std::unique_lock lock(mutex);
+                    available.wait(lock, [this] { return stopping || !pending.empty(); });
+                    if (pending.empty()) {
+                        return;
+                    }
+                    batch = TakeBatch();
+                }
+                std::vector<domain::Match> matches;
+                matches.reserve(batch.size());
+                for (const auto& submission : batch) {
+                    matches.push_back(submission.match);
+                }
+                std::vector<std::expected<std::string, Error>> results;
+                try {
+                    results = matchDelegate->UpdateMatchScores(matches);
+                } catch (const std::exception&) {
+                    results.assign(batch.size(), std::unexpected(Error::UNKNOWN_ERROR));
+                }
+                Finish(batch, results);
+            }
+        }
+
+    public:
+        ScoreSubmissionQueue(std::shared_ptr<IMatchDelegate> matchDelegate, std::size_t capacity, std::size_t batchSize)
+            : matchDelegate(std::move(matchDelegate)), capacity(capacity), batchSize(std::max<std::size_t>(1, batchSize)),
+              worker([this] { Run(); }) {}
+
+        ~ScoreSubmissionQueue() { Close(); }
+
+        // Stops accepting submissions and returns once everything already queued has been written and
+        // published. Called at shutdown before the broker connection goes away.
+        void Close() {
+            {
+                std::lock_guard lock(mutex);
+                stopping = true;
+            }
+            available.notify_all();
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+
+        ScoreSubmissionQueue(const ScoreSubmissionQueue&) = delete;
+        ScoreSubmissionQueue& operator=(const ScoreSubmissionQueue&) = delete;
+
+        // Operation id, or nullopt when the queue is full and the caller should back off.
+        std::optional<std::string> Submit(const domain::Match& match) {
+            std::string operationId = NewOperationId();
+            {
+                std::lock_guard lock(mutex);
+                if (stopping || pending.size() >= capacity) {
+                    return std::nullopt;
+                }
+                operations.emplace(operationId, Operation{operationId, match.TournamentId(), match.Id()});
+                pending.push_back({operationId, match});
+            }
+            available.notify_one();
+            return operationId;
+        }
+
+        std::optional<Operation> Find(const std::string& operationId) const {
+            std::lock_guard lock(mutex);
+            const auto operation = operations.find(operationId);
+            if (operation == operations.end()) {
+                return std::nullopt;
+            }
+            return operation->second;
+        }
+
+        std::size_t Pending() const {
+            std::lock_guard lock(mutex);
+            return pending.size();
+        }
+    };
+}
+
+#endif //RESTAPI_SCORE_SUBMISSION_QUEUE_HPP
@@ -0,0 +1,76 @@
+#ifndef RESTAPI_WORKER_POOL_HPP
+#define RESTAPI_WORKER_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Fixed set of long-lived threads for work that leaves the request thread. Long-lived matters: every thread
+// carries its own request arena and metrics shard, so spawning one per task would keep allocating both.
+// The destructor finishes the queued tasks before joining.
+namespace concurrency {
+    class WorkerPool {
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<std::move_only_function<void()>> tasks;
+        bool stopping = false;
+        std::vector<std::jthread> workers;
+
+        void Run() {
+            while (true) {
+                std::move_only_function<void()> task;
+                {
+                    std::unique_lock lock(mutex);
+                    available.wait(lock, [this] { return stopping || !tasks.empty(); });
+                    if (tasks.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+    public:
+        explicit WorkerPool(std::size_t threads) {
+            workers.reserve(threads);
+            for (std::size_t i = 0; i < threads; ++i) {
+                workers.emplace_back([this] { Run(); });
+            }
+        }
+
+        ~WorkerPool() {
+            {
+                std::lock_guard lock(mutex);
+                stopping = true;
+            }
+            available.notify_all();
+        }
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // Exceptions thrown by work are delivered through the future.
+        template<typename Work>
+        std::future<std::invoke_result_t<Work>> Submit(Work&& work) {
+            std::packaged_task<std::invoke_result_t<Work>()> task(std::forward<Work>(work));
+            auto future = task.get_future();
+            {
+                std::lock_guard lock(mutex);
+                tasks.emplace_back(std::move(task));
+            }
+            available.notify_one();
+            return future;
+        }
+    };
+}
+
+#endif //RESTAPI_WORKER_POOL_HPP
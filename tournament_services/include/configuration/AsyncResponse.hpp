@@ -0,0 +1,33 @@
+#ifndef RESTAPI_ASYNC_RESPONSE_HPP
+#define RESTAPI_ASYNC_RESPONSE_HPP
+
+#include <crow.h>
+#include <memory>
+#include <utility>
+
+#include "metrics/Metrics.hpp"
+
+// What REGISTER_ASYNC_ROUTE handlers get instead of returning a response. Copies may be kept past the handler
+// and End called once, from any thread: the response is handed back to the connection's io thread, so Crow's
+// connection state is only touched there, and observed for /metrics when it completes.
+class AsyncResponse {
+    crow::response* response;
+    asio::io_context* connection;
+    metrics::PendingRequest observation;
+
+public:
+    AsyncResponse(const crow::request& request, crow::response& response, metrics::PendingRequest observation)
+        : response(&response), connection(request.io_context), observation(std::move(observation)) {}
+
+    void End(crow::response result) const {
+        // shared so the handler stays copyable whatever the executor requires
+        auto completed = std::make_shared<crow::response>(std::move(result));
+        asio::post(*connection, [target = response, completed, observation = observation] {
+            *target = std::move(*completed);
+            observation.Finish(target->code);
+            target->end();
+        });
+    }
+};
+
+#endif //RESTAPI_ASYNC_RESPONSE_HPP
@@ -16,6 +16,14 @@
 #include "cms/ConnectionManager.hpp"
 #include "delegate/TeamDelegate.hpp"
 #include "controller/HealthController.hpp"
+#include "health/HealthMonitor.hpp"
+#include "controller/MetricsController.hpp"
+#include "controller/BatchController.hpp"
+#include "controller/TournamentEventsController.hpp"
+#include "controller/BracketController.hpp"
+#include "events/ChangeVersions.hpp"
+#include "events/MatchChangeListener.hpp"
+#include "events/TournamentEventHub.hpp"
 #include "controller/TeamController.hpp"
 #include "controller/TournamentController.hpp"
 #include "delegate/TournamentDelegate.hpp"
@@ -33,6 +41,9 @@
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/MatchRepository.hpp"
 #include "controller/MatchController.hpp"
+#include "controller/OperationController.hpp"
+#include "concurrency/ScoreSubmissionQueue.hpp"
+#include "middleware/AdmissionControl.hpp"
 
 namespace config {
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
@@ -43,12 +54,21 @@ namespace config {
         file >> configuration;
         std::shared_ptr<RunConfiguration> appConfig = std::make_shared<RunConfiguration>(configuration["runConfig"]);
         builder.registerInstance(appConfig);
+        builder.registerInstance(std::make_shared<concurrency::WorkerPool>(static_cast<std::size_t>(appConfig->workerThreads)));
 
         std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
             configuration["databaseConfig"]["connectionString"].get<std::string>(),
             configuration["databaseConfig"]["poolSize"].get<size_t>());
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
+        const auto& admissionConfig = configuration["admission"];
+        builder.registerInstance(std::make_shared<admission::AdmissionController>(
+            postgressConnection,
+            admission::Budget{admissionConfig["reads"]["minimum"].get<int>(), admissionConfig["reads"]["maximum"].get<int>()},
+            admission::Budget{admissionConfig["writes"]["minimum"].get<int>(), admissionConfig["writes"]["maximum"].get<int>()},
+            appConfig->concurrency,
+            std::chrono::milliseconds(admissionConfig["targetPoolWaitMs"].get<int>())));
+
         builder.registerType<ConnectionManager>()
             .onActivated([configuration](Hypodermic::ComponentContext&, const std::shared_ptr<ConnectionManager>& instance) {
                 instance->initialize(configuration["activemq"]["broker-url"].get<std::string>());
@@ -66,7 +86,10 @@ namespace config {
         builder.registerType<QueueResolver>().as<IResolver<IQueueMessageProducer> >().named("queueResolver").
                 singleInstance();
 
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string_view> >().singleInstance();
+        builder.registerType<TeamRepository>()
+            .as<ITeamRepository>()
+            .as<IRepository<domain::Team, std::string_view> >()
+            .singleInstance();
         builder.registerType<GroupRepository>().as<IGroupRepository>().singleInstance();
 
         builder.registerType<TeamDelegate>().as<ITeamDelegate>().singleInstance();
@@ -86,7 +109,18 @@ namespace config {
             })
             .singleInstance();
         builder.registerType<GroupController>().singleInstance();
+        // readiness: database and broker checked in the background, probes read the cached result
+        const auto healthInterval = std::chrono::milliseconds(configuration["health"].value("intervalMs", 2000));
+        builder.registerInstanceFactory([postgressConnection, healthInterval](Hypodermic::ComponentContext& context) {
+                auto connectionManager = context.resolve<ConnectionManager>();
+                return std::make_shared<health::HealthMonitor>(std::vector<health::Check>{
+                    {"database", [postgressConnection, healthInterval] { return postgressConnection->Ping(healthInterval); }},
+                    {"broker", [connectionManager] { return connectionManager->IsConnected(); }},
+                }, healthInterval);
+            })
+            .singleInstance();
         builder.registerType<HealthController>().singleInstance();
+        builder.registerType<MetricsController>().singleInstance();
 
         builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
         builder.registerType<MatchDelegate>().as<IMatchDelegate>()
@@ -94,7 +128,29 @@ namespace config {
                 return context.resolveNamed<QueueMessageProducer>("tournamentScoreUpdateQueue");
             })
             .singleInstance();
+        // PATCH ... Prefer: respond-async: one worker batches queued scores into single writes and messages
+        const auto& scoreQueueConfig = configuration["scoreQueue"];
+        builder.registerInstanceFactory([scoreQueueConfig](Hypodermic::ComponentContext& context) {
+                return std::make_shared<concurrency::ScoreSubmissionQueue>(
+                    context.resolve<IMatchDelegate>(),
+                    scoreQueueConfig.value("capacity", std::size_t{1024}),
+                    scoreQueueConfig.value("batchSize", std::size_t{64}));
+            })
+            .singleInstance();
         builder.registerType<MatchController>().singleInstance();
+        builder.registerType<OperationController>().singleInstance();
+        builder.registerType<BatchController>().singleInstance();
+
+        // live match feed: one LISTEN connection, fanned out by the hub to every viewer and moving the
+        // versions cached brackets are checked against
+        auto eventHub = std::make_shared<events::TournamentEventHub>();
+        auto changeVersions = std::make_shared<events::ChangeVersions>();
+        builder.registerInstance(eventHub);
+        builder.registerInstance(changeVersions);
+        builder.registerInstance(std::make_shared<events::MatchChangeListener>(
+            eventHub, changeVersions, configuration["databaseConfig"]["connectionString"].get<std::string>()));
+        builder.registerType<TournamentEventsController>().singleInstance();
+        builder.registerType<BracketController>().singleInstance();
 
         return builder.build();
     }
@@ -7,15 +7,32 @@
 
 #include <crow.h>
 #include <Hypodermic/Container.h>
+#include <algorithm>
+#include <cstddef>
 #include <vector>
 #include <functional>
+#include <string_view>
+#include <utility>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+
+#include "configuration/AsyncResponse.hpp"
+#include "memory/RequestArena.hpp"
+#include "metrics/Metrics.hpp"
+#include "middleware/AdmissionControl.hpp"
+#include "middleware/Compression.hpp"
+#include "middleware/Drain.hpp"
+
+// Every request is counted for shutdown draining, then passes admission control before any handler runs;
+// every response goes through compression on its way out.
+using ServiceApp = crow::App<DrainMiddleware, AdmissionMiddleware, CompressionMiddleware>;
 
 // Route definition storage
 struct RouteDefinition {
     std::string path;
     crow::HTTPMethod method;
-    std::function<void(crow::SimpleApp &, std::shared_ptr<Hypodermic::Container>)> binder;
+    std::function<void(ServiceApp &, std::shared_ptr<Hypodermic::Container>)> binder;
 };
 
 inline std::vector<RouteDefinition> &routeRegistry() {
@@ -23,6 +40,68 @@ inline std::vector<RouteDefinition> &routeRegistry() {
     return registry;
 }
 
+// Handlers as bound to Crow, callable without going through HTTP (POST /batch). Filled while binding at
+// startup and only read afterwards.
+struct BoundRoute {
+    crow::HTTPMethod method;
+    std::string path;
+    std::function<crow::response(const crow::request&, const std::vector<std::string>&)> handler;
+};
+
+inline std::vector<BoundRoute> &boundRoutes() {
+    static std::vector<BoundRoute> routes;
+    return routes;
+}
+
+constexpr std::size_t PathParameterCount(std::string_view path) {
+    return static_cast<std::size_t>(std::count(path.begin(), path.end(), '<'));
+}
+
+// Matches a concrete path against the bound templates, segment by segment; <...> segments capture into
+// parameters. Static routes win over parameterized ones, as in Crow.
+inline const BoundRoute* FindBoundRoute(crow::HTTPMethod method, std::string_view path, std::vector<std::string>& parameters) {
+    const auto segments = [](std::string_view value) {
+        std::vector<std::string_view> parts;
+        while (!value.empty()) {
+            const auto slash = value.find('/');
+            if (slash != 0) {
+                parts.push_back(value.substr(0, slash));
+            }
+            value = slash == std::string_view::npos ? std::string_view{} : value.substr(slash + 1);
+        }
+        return parts;
+    };
+    const auto actual = segments(path);
+
+    const BoundRoute* best = nullptr;
+    for (const auto& route : boundRoutes()) {
+        if (route.method != method) {
+            continue;
+        }
+        const auto expected = segments(route.path);
+        if (expected.size() != actual.size()) {
+            continue;
+        }
+        std::vector<std::string> captured;
+        bool matches = true;
+        for (std::size_t i = 0; i < expected.size() && matches; ++i) {
+            if (expected[i].starts_with('<')) {
+                captured.emplace_back(actual[i]);
+            } else {
+                matches = expected[i] == actual[i];
+            }
+        }
+        if (matches && (!best || captured.size() < parameters.size())) {
+            best = &route;
+            parameters = std::move(captured);
+        }
+    }
+    return best;
+}
+
+// Picks the handler signature at compile time: (), (args...), (request) or (request, args...).
+// The fallback stays a runtime throw: Crow probes the generic route lambda with signatures we do not
+// serve, and a static_assert there would fail the build.
 template<typename Controller, typename Method, typename... Args>
 auto invokeController(Controller* controller, Method method, const crow::request& request, Args&&... args) {
     if constexpr(std::is_invocable_v<Method, Controller*>) {
@@ -34,7 +113,7 @@ auto invokeController(Controller* controller, Method method, const crow::request
     else if constexpr( std::is_invocable_v<Method, Controller*, const crow::request&>) {
         return (controller->*method)(request);
     }
-    if constexpr(std::is_invocable_v<Method, Controller*, const crow::request&, Args...>) {
+    else if constexpr(std::is_invocable_v<Method, Controller*, const crow::request&, Args...>) {
         return (controller->*method)(request, std::forward<Args>(args)...);
     }
     else  {
@@ -43,18 +122,64 @@ auto invokeController(Controller* controller, Method method, const crow::request
 
 }
 
-// Annotation-style macro
+// Calls a bound handler with the first Count path parameters as its route arguments.
+template<std::size_t Count, typename Handler>
+crow::response invokeWithParameters(const Handler& handler, const crow::request& request, const std::vector<std::string>& parameters) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return handler(request, parameters[I]...);
+    }(std::make_index_sequence<Count>{});
+}
+
+// Annotation-style macro. Controllers are registered singleInstance, so each one is resolved once when its
+// routes are bound and the handler keeps it alive; a request only pays for the member function call.
+// Each handler runs inside a RequestScope, so repository reads for the request are served from the worker
+// thread's arena and released together once the response has been built, and is timed under its path
+// template for /metrics. The same handler is also kept in boundRoutes() for in-process dispatch.
 #define REGISTER_ROUTE(Controller, Method, Path, HttpMethod) \
 struct Controller## _##Method##_RouteRegistrator { \
     Controller##_##Method##_RouteRegistrator() { \
         routeRegistry().push_back({ Path, HttpMethod, \
-            [](crow::SimpleApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
+            [](ServiceApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
+                    std::shared_ptr<Controller> controller = container->resolve<Controller>(); \
+                    const metrics::RouteId routeId = metrics::Registry::Instance().RegisterRoute(crow::method_name(HttpMethod), Path); \
+                    const auto handler = [controller, routeId](const crow::request& request ,auto&&... args) { \
+                        memory::RequestScope requestScope; \
+                        return metrics::ObserveRoute(routeId, [&] { \
+                            return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                        }); \
+                    }; \
+                    boundRoutes().push_back({ HttpMethod, Path, \
+                        [handler](const crow::request& request, const std::vector<std::string>& parameters) { \
+                            return invokeWithParameters<PathParameterCount(Path)>(handler, request, parameters); \
+                        } \
+                    }); \
+                    CROW_ROUTE(app, Path).methods(HttpMethod)(handler); \
+            } \
+        }); \
+    } \
+}; \
+static Controller##_##Method##_RouteRegistrator global_##Controller##_##Method##_registrator;
+
+// For handlers that take (request, AsyncResponse, args...) and end the response later, from another thread.
+// Status and latency are recorded when the response ends; the in-flight gauge only covers the handler call.
+// They are not kept in boundRoutes(): a response that is not complete when the handler returns has nothing to
+// hand back to a batch.
+#define REGISTER_ASYNC_ROUTE(Controller, Method, Path, HttpMethod) \
+struct Controller## _##Method##_RouteRegistrator { \
+    Controller##_##Method##_RouteRegistrator() { \
+        routeRegistry().push_back({ Path, HttpMethod, \
+            [](ServiceApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
+                    std::shared_ptr<Controller> controller = container->resolve<Controller>(); \
+                    const metrics::RouteId routeId = metrics::Registry::Instance().RegisterRoute(crow::method_name(HttpMethod), Path); \
                     CROW_ROUTE(app, Path).methods(HttpMethod)( \
-                        [container](const crow::request& request ,auto&&... args) { \
-                        auto controller = container->resolve<Controller>(); \
-                        return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
-                    } \
-                ); \
+                        [controller, routeId](const crow::request& request, crow::response& response, auto&&... args) -> void { \
+                            memory::RequestScope requestScope; \
+                            metrics::ObserveRoute(routeId, [&] { \
+                                (controller.get()->*&Controller::Method)(request, \
+                                    AsyncResponse(request, response, metrics::PendingRequest(routeId)), \
+                                    std::forward<decltype(args)>(args)...); \
+                            }); \
+                        }); \
             } \
         }); \
     } \
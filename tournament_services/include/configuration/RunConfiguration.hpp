@@ -6,11 +6,20 @@ namespace config{
     struct RunConfiguration{
         int port;
         int concurrency;
+        // Threads POST /batch fans independent sub-requests out to.
+        int workerThreads = 4;
+        // Shutdown: how long /health/ready reports draining before the server stops taking requests (the
+        // load balancer needs a few failed checks), then how long in-flight requests get to finish.
+        int shutdownGraceMs = 5000;
+        int drainTimeoutMs = 15000;
     };
 
     inline void from_json(const nlohmann::json& json, RunConfiguration& applicationProperties) {
         json.at("port").get_to(applicationProperties.port);
         json.at("concurrency").get_to(applicationProperties.concurrency);
+        applicationProperties.workerThreads = json.value("workerThreads", 4);
+        applicationProperties.shutdownGraceMs = json.value("shutdownGraceMs", 5000);
+        applicationProperties.drainTimeoutMs = json.value("drainTimeoutMs", 15000);
     }
 }
 #endif
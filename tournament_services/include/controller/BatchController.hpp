@@ -0,0 +1,39 @@
+#ifndef RESTAPI_BATCH_CONTROLLER_HPP
+#define RESTAPI_BATCH_CONTROLLER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <crow.h>
+
+#include "concurrency/WorkerPool.hpp"
+
+// POST /batch: runs an array of sub-requests through the bound route table in one round trip.
+//
+//   [{"method": "PATCH", "path": "/tournaments/{id}/matches/{id}", "body": {...}, "headers": {...},
+//     "dependsOn": [0]}, ...]
+//
+// Items are independent unless they list earlier items in dependsOn; independent items run concurrently on
+// the worker pool, dependent ones once their dependencies finished, and not at all (424) if one of them
+// failed. The response is an array in request order: {"status", "headers", "body"}, JSON bodies inlined.
+class BatchController {
+    std::shared_ptr<concurrency::WorkerPool> workers;
+public:
+    static constexpr std::size_t MAX_ITEMS = 100;
+
+    struct Item {
+        crow::HTTPMethod method = crow::HTTPMethod::Get;
+        std::string path;
+        std::string body;
+        std::vector<std::pair<std::string, std::string>> headers;
+        std::vector<std::size_t> dependsOn;
+    };
+
+    explicit BatchController(const std::shared_ptr<concurrency::WorkerPool>& workers);
+
+    crow::response execute(const crow::request& request);
+};
+
+#endif //RESTAPI_BATCH_CONTROLLER_HPP
@@ -0,0 +1,39 @@
+#ifndef RESTAPI_BRACKET_CONTROLLER_HPP
+#define RESTAPI_BRACKET_CONTROLLER_HPP
+
+#include <crow.h>
+#include <expected>
+#include <memory>
+#include <string>
+
+#include "controller/ResponseCache.hpp"
+#include "controller/SingleFlight.hpp"
+#include "delegate/IMatchDelegate.hpp"
+#include "events/ChangeVersions.hpp"
+#include "exception/Error.hpp"
+#include "serialization/Encoding.hpp"
+
+// GET /tournaments/{id}/bracket: the whole tree a bracket view needs (rounds, teams by name, scores) in one
+// response built from one query. Rendered bodies are cached under the tournament's ChangeVersions entry, so
+// until a match of the tournament changes a request costs neither a query nor a render. While the change feed
+// is down nothing is cached.
+class BracketController {
+    std::shared_ptr<IMatchDelegate> matchDelegate;
+    std::shared_ptr<events::ChangeVersions> versions;
+    ResponseCache responseCache;
+
+    struct RenderedBracket {
+        std::shared_ptr<const ResponseCache::Body> body;
+    };
+    SingleFlight<std::expected<RenderedBracket, Error>> bracketFlights;
+
+    std::expected<RenderedBracket, Error> renderBracket(const crow::request& request, const std::string& tournamentId,
+                                                        const std::string& version, const std::string& cacheKey);
+public:
+    BracketController(const std::shared_ptr<IMatchDelegate>& matchDelegate,
+                      const std::shared_ptr<events::ChangeVersions>& versions);
+
+    crow::response getBracket(const crow::request& request, const std::string& tournamentId);
+};
+
+#endif //RESTAPI_BRACKET_CONTROLLER_HPP
@@ -21,8 +21,8 @@ class GroupController
 public:
     GroupController(const std::shared_ptr<IGroupDelegate>& delegate);
     ~GroupController();
-    crow::response GetGroups(const std::string& tournamentId);
-    crow::response GetGroup(const std::string& tournamentId, const std::string& groupId);
+    crow::response GetGroups(const crow::request& request, const std::string& tournamentId);
+    crow::response GetGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId);
     crow::response CreateGroup(const crow::request& request, const std::string& tournamentId);
     crow::response UpdateGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId);
     crow::response AddTeams(const crow::request& request, const std::string& tournamentId, const std::string& groupId);
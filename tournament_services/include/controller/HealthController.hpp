@@ -5,14 +5,49 @@
 #ifndef TOURNAMENTS_HEALTHCONTROLLER_HPP
 #define TOURNAMENTS_HEALTHCONTROLLER_HPP
 
+#include <chrono>
+#include <memory>
+
 #include "configuration/RouteDefinition.hpp"
+#include "health/HealthMonitor.hpp"
+#include "serialization/JsonWriter.hpp"
 
+// /health/live: the process answers HTTP; it never looks at dependencies, so an outage of Postgres or the
+// broker does not get every instance restarted. /health/ready: whether this instance should receive traffic,
+// read from the monitor's cached snapshot. /health is kept for existing checks and means live.
 class HealthController {
-    public:
+    std::shared_ptr<health::HealthMonitor> monitor;
+public:
+    explicit HealthController(const std::shared_ptr<health::HealthMonitor>& monitor) : monitor(monitor) {}
+
     crow::response GetHealth(){
         return crow::response{crow::OK, "Services running"};
     }
+
+    crow::response GetLive() {
+        return crow::response{crow::OK, "alive"};
+    }
+
+    // {"status": "ready" | "unavailable" | "draining", "dependencies": {"database": "up", ...}}
+    crow::response GetReady() {
+        const auto snapshot = monitor->Current(std::chrono::steady_clock::now());
+        crow::response response{snapshot.ready ? crow::OK : crow::SERVICE_UNAVAILABLE};
+        serialization::JsonWriter writer(response.body);
+        writer.BeginObject();
+        writer.Key("status").String(snapshot.draining ? "draining" : snapshot.ready ? "ready" : "unavailable");
+        writer.Key("dependencies").BeginObject();
+        for (const auto& dependency : snapshot.dependencies) {
+            writer.Key(dependency.name).String(dependency.up ? "up" : "down");
+        }
+        writer.EndObject();
+        writer.EndObject();
+        response.add_header("content-type", "application/json");
+        response.add_header("cache-control", "no-store");
+        return response;
+    }
 };
 
 REGISTER_ROUTE(HealthController, GetHealth, "/health", "GET"_method)
-#endif //TOURNAMENTS_HEALTHCONTROLLER_HPP
\ No newline at end of file
+REGISTER_ROUTE(HealthController, GetLive, "/health/live", "GET"_method)
+REGISTER_ROUTE(HealthController, GetReady, "/health/ready", "GET"_method)
+#endif //TOURNAMENTS_HEALTHCONTROLLER_HPP
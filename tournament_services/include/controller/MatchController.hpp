@@ -1,21 +1,44 @@
 #ifndef RESTAPI_MATCH_CONTROLLER_HPP
 #define RESTAPI_MATCH_CONTROLLER_HPP
 
+#include <expected>
 #include <string>
 #include <crow.h>
 #include <nlohmann/json.hpp>
 #include <memory>
-#include <regex>
 
+#include "concurrency/ScoreSubmissionQueue.hpp"
+#include "controller/ResponseCache.hpp"
+#include "controller/SingleFlight.hpp"
 #include "delegate/IMatchDelegate.hpp"
 #include "domain/Constants.hpp"
+#include "exception/Error.hpp"
+#include "serialization/Encoding.hpp"
+#include "serialization/FieldSet.hpp"
 
 class MatchController {
     std::shared_ptr<IMatchDelegate> matchDelegate;
+    // PATCH with Prefer: respond-async lands here and is answered with 202
+    std::shared_ptr<concurrency::ScoreSubmissionQueue> scoreQueue;
+    // match lists by tournament, representation and fieldset; scoreboards poll them
+    ResponseCache responseCache;
+
+    // Final bytes of one match list at one version, shared by concurrent identical requests.
+    struct RenderedList {
+        std::shared_ptr<const ResponseCache::Body> body;
+    };
+    SingleFlight<std::expected<std::string, Error>> matchVersionFlights;
+    SingleFlight<std::expected<RenderedList, Error>> matchListFlights;
+
+    std::expected<RenderedList, Error> renderMatches(const crow::request& request, const std::string& tournamentId,
+                                                     const std::string& version, serialization::Encoding encoding,
+                                                     const serialization::FieldSet<domain::Match>& fields,
+                                                     const std::string& cacheKey);
 public:
-    explicit MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate);
-    crow::response getMatch(const std::string& tournamentId, const std::string& matchId);
-    crow::response getMatches(const std::string& tournamentId);
+    MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate,
+                    const std::shared_ptr<concurrency::ScoreSubmissionQueue>& scoreQueue);
+    crow::response getMatch(const crow::request& request, const std::string& tournamentId, const std::string& matchId);
+    crow::response getMatches(const crow::request& request, const std::string& tournamentId);
     crow::response updateMatchScore(const crow::request& request, const std::string& tournamentId, const std::string& matchId);
 };
 
@@ -0,0 +1,23 @@
+#ifndef TOURNAMENTS_METRICSCONTROLLER_HPP
+#define TOURNAMENTS_METRICSCONTROLLER_HPP
+
+#include <memory>
+
+#include "configuration/RouteDefinition.hpp"
+#include "metrics/Metrics.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+class MetricsController {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit MetricsController(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(connectionProvider) {}
+
+    crow::response GetMetrics() {
+        crow::response response{crow::OK, metrics::Registry::Instance().Render(connectionProvider)};
+        response.add_header("content-type", "text/plain; version=0.0.4; charset=utf-8");
+        return response;
+    }
+};
+
+REGISTER_ROUTE(MetricsController, GetMetrics, "/metrics", "GET"_method)
+#endif //TOURNAMENTS_METRICSCONTROLLER_HPP
@@ -0,0 +1,20 @@
+#ifndef RESTAPI_OPERATION_CONTROLLER_HPP
+#define RESTAPI_OPERATION_CONTROLLER_HPP
+
+#include <crow.h>
+#include <memory>
+#include <string>
+
+#include "concurrency/ScoreSubmissionQueue.hpp"
+
+// GET /operations/{id}: where a 202 from PATCH /tournaments/{id}/matches/{id} points. Answers from the
+// submission queue's memory only, so polling never reaches the database.
+class OperationController {
+    std::shared_ptr<concurrency::ScoreSubmissionQueue> scoreQueue;
+public:
+    explicit OperationController(const std::shared_ptr<concurrency::ScoreSubmissionQueue>& scoreQueue);
+
+    [[nodiscard]] crow::response getOperation(const std::string& operationId) const;
+};
+
+#endif //RESTAPI_OPERATION_CONTROLLER_HPP
@@ -0,0 +1,69 @@
+#ifndef RESTAPI_REQUEST_BODY_HPP
+#define RESTAPI_REQUEST_BODY_HPP
+
+#include <expected>
+#include <optional>
+#include <string>
+#include <vector>
+#include <crow.h>
+
+#include "serialization/Encoding.hpp"
+#include "serialization/JsonWriter.hpp"
+#include "serialization/RequestSchema.hpp"
+
+// Structured 400 shared by the controllers: {"field": "score.homeTeamScore", "message": "..."}.
+// field is omitted when the error is not tied to a member (e.g. malformed JSON).
+inline crow::response BadRequest(const serialization::RequestError& error) {
+    crow::response response{crow::BAD_REQUEST};
+    serialization::JsonWriter writer(response.body);
+    writer.BeginObject();
+    if (!error.field.empty()) {
+        writer.Key("field").String(error.field);
+    }
+    writer.Key("message").String(error.message);
+    writer.EndObject();
+    response.add_header("content-type", "application/json");
+    return response;
+}
+
+// Bodies sent as MessagePack or CBOR (per Content-Type) are transcoded to JSON so every encoding goes
+// through the same schemas. Returns nullopt for JSON bodies, which are decoded in place.
+inline std::expected<std::optional<std::string>, crow::response> TranscodedBody(const crow::request& request) {
+    const auto encoding = serialization::EncodingOf(request.get_header_value("Content-Type"));
+    if (encoding == serialization::Encoding::JSON) {
+        return std::nullopt;
+    }
+    auto json = serialization::TranscodeToJson(request.body, encoding);
+    if (!json) {
+        return std::unexpected(BadRequest({"", "Invalid " + std::string(serialization::ContentType(encoding)) + " body"}));
+    }
+    return json;
+}
+
+template<typename T>
+std::expected<T, crow::response> DecodeBody(const crow::request& request, serialization::Schema<T> schema) {
+    auto transcoded = TranscodedBody(request);
+    if (!transcoded) {
+        return std::unexpected(std::move(transcoded.error()));
+    }
+    auto decoded = serialization::DecodeRequest<T>(transcoded->has_value() ? **transcoded : request.body, schema);
+    if (!decoded) {
+        return std::unexpected(BadRequest(decoded.error()));
+    }
+    return std::move(*decoded);
+}
+
+template<typename T>
+std::expected<std::vector<T>, crow::response> DecodeArrayBody(const crow::request& request, serialization::Schema<T> schema) {
+    auto transcoded = TranscodedBody(request);
+    if (!transcoded) {
+        return std::unexpected(std::move(transcoded.error()));
+    }
+    auto decoded = serialization::DecodeArrayRequest<T>(transcoded->has_value() ? **transcoded : request.body, schema);
+    if (!decoded) {
+        return std::unexpected(BadRequest(decoded.error()));
+    }
+    return std::move(*decoded);
+}
+
+#endif //RESTAPI_REQUEST_BODY_HPP
@@ -0,0 +1,126 @@
+#ifndef RESTAPI_RESPONSE_BODY_HPP
+#define RESTAPI_RESPONSE_BODY_HPP
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <crow.h>
+
+#include "controller/ResponseCache.hpp"
+#include "middleware/Compression.hpp"
+#include "serialization/Encoding.hpp"
+
+// Encodes value in the representation the client asked for through Accept (JSON, MessagePack or CBOR).
+template<typename T>
+crow::response EncodedResponse(const crow::request& request, const T& value) {
+    const auto encoding = serialization::NegotiateEncoding(request.get_header_value("Accept"));
+    crow::response response{crow::OK};
+    serialization::Encode(response.body, encoding, value);
+    response.add_header("content-type", std::string(serialization::ContentType(encoding)));
+    response.add_header("vary", "Accept");
+    return response;
+}
+
+// Lists reserve the body up front from a per-entity size estimate (JSON bytes).
+template<typename T, typename Allocator>
+crow::response EncodedResponse(const crow::request& request, const std::vector<T, Allocator>& entities, std::size_t bytesPerEntity) {
+    const auto encoding = serialization::NegotiateEncoding(request.get_header_value("Accept"));
+    crow::response response{crow::OK};
+    serialization::Encode(response.body, encoding, entities, bytesPerEntity);
+    response.add_header("content-type", std::string(serialization::ContentType(encoding)));
+    response.add_header("vary", "Accept");
+    return response;
+}
+
+// Sparse list (?fields=): only the members in fields are written.
+template<serialization::Described T, typename Allocator>
+crow::response EncodedResponse(const crow::request& request, const std::vector<T, Allocator>& entities, std::size_t bytesPerEntity,
+                               const serialization::FieldSet<T>& fields) {
+    const auto encoding = serialization::NegotiateEncoding(request.get_header_value("Accept"));
+    crow::response response{crow::OK};
+    serialization::Encode(response.body, encoding, entities, bytesPerEntity, fields);
+    response.add_header("content-type", std::string(serialization::ContentType(encoding)));
+    response.add_header("vary", "Accept");
+    return response;
+}
+
+inline bool WantsJson(const crow::request& request) {
+    return serialization::NegotiateEncoding(request.get_header_value("Accept")) == serialization::Encoding::JSON;
+}
+
+// Body already rendered as JSON (by the database), sent as is.
+inline crow::response RenderedJsonResponse(std::string body) {
+    crow::response response{crow::OK, std::move(body)};
+    response.add_header("content-type", std::string(serialization::ContentType(serialization::Encoding::JSON)));
+    response.add_header("vary", "Accept");
+    return response;
+}
+
+// Strong validator for one representation of one version of a resource; the encoding is part of the tag
+// because the bytes differ per Accept.
+inline std::string EntityTag(std::string_view version, serialization::Encoding encoding) {
+    std::string tag;
+    tag.reserve(version.size() + 16);
+    tag += '"';
+    tag += version;
+    tag += '-';
+    tag += serialization::ContentType(encoding).substr(std::string_view("application/").size());
+    tag += '"';
+    return tag;
+}
+
+// If-None-Match is a comma separated list of tags (or "*") compared weakly, so W/ prefixes are ignored, as are
+// the content-coding suffixes the compression middleware adds. Returns the client's tag that matched.
+inline std::optional<std::string> IfNoneMatch(const crow::request& request, std::string_view tag) {
+    std::string_view header = request.get_header_value("If-None-Match");
+    while (!header.empty()) {
+        const auto comma = header.find(',');
+        std::string_view candidate = compression::detail::Trim(header.substr(0, comma));
+        header = comma == std::string_view::npos ? std::string_view{} : header.substr(comma + 1);
+
+        if (candidate.starts_with("W/")) {
+            candidate.remove_prefix(2);
+        }
+        if (candidate == "*") {
+            return std::string(tag);
+        }
+        if (!candidate.empty() && compression::UncodedTag(candidate) == tag) {
+            return std::string(candidate);
+        }
+    }
+    return std::nullopt;
+}
+
+inline crow::response NotModified(const std::string& tag) {
+    crow::response response{crow::NOT_MODIFIED};
+    response.add_header("etag", tag);
+    response.add_header("vary", "Accept, Accept-Encoding");
+    return response;
+}
+
+// Body rendered (and possibly compressed) earlier for the same representation and version.
+inline crow::response CachedResponse(serialization::Encoding encoding, const ResponseCache::Body& cached, const std::string& tag) {
+    crow::response response{crow::OK, cached.bytes};
+    response.add_header("content-type", std::string(serialization::ContentType(encoding)));
+    response.add_header("vary", "Accept");
+    if (cached.contentEncoding.empty()) {
+        response.add_header("etag", tag);
+    } else {
+        response.add_header("content-encoding", cached.contentEncoding);
+        response.add_header("etag", compression::TagFor(tag, cached.contentEncoding));
+        compression::AddVary(response);
+    }
+    return response;
+}
+
+// Compresses a freshly rendered response for this client and caches the final bytes, so later hits skip
+// both rendering and compression.
+inline std::shared_ptr<const ResponseCache::Body> StoreResponse(ResponseCache& cache, const std::string& key, std::string version,
+                                                                const crow::request& request, crow::response& response) {
+    compression::CompressResponse(request, response);
+    return cache.Store(key, std::move(version), std::move(response.body), response.get_header_value("content-encoding"));
+}
+
+#endif //RESTAPI_RESPONSE_BODY_HPP
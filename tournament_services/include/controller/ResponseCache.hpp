@@ -0,0 +1,64 @@
+#ifndef RESTAPI_RESPONSE_CACHE_HPP
+#define RESTAPI_RESPONSE_CACHE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Serialized response bodies keyed by resource (path, representation and accepted coding), each tagged with
+// the version of the data it was rendered from. A lookup only hits while the caller's version is still the
+// cached one, so entries never need explicit invalidation: the next render under a new version replaces them.
+//
+// Bodies are plain heap strings shared between threads; never store anything allocated from a request arena.
+class ResponseCache {
+public:
+    // Bytes as sent; contentEncoding is empty unless they were compressed.
+    struct Body {
+        std::string bytes;
+        std::string contentEncoding;
+    };
+
+private:
+    struct Entry {
+        std::string version;
+        std::shared_ptr<const Body> body;
+    };
+
+    std::size_t capacity;
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+
+public:
+    explicit ResponseCache(std::size_t capacity = 1024) : capacity(capacity) {}
+
+    std::shared_ptr<const Body> Find(const std::string& key, std::string_view version) const {
+        std::shared_lock lock(mutex);
+        const auto it = entries.find(key);
+        if (it == entries.end() || it->second.version != version) {
+            return nullptr;
+        }
+        return it->second.body;
+    }
+
+    std::shared_ptr<const Body> Store(const std::string& key, std::string version, std::string bytes, std::string contentEncoding = {}) {
+        auto shared = std::make_shared<const Body>(Body{std::move(bytes), std::move(contentEncoding)});
+        std::unique_lock lock(mutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            // Full: drop an arbitrary entry; a miss only costs one render.
+            if (entries.size() >= capacity && !entries.empty()) {
+                entries.erase(entries.begin());
+            }
+            entries.emplace(key, Entry{std::move(version), shared});
+        } else {
+            it->second = Entry{std::move(version), shared};
+        }
+        return shared;
+    }
+};
+
+#endif //RESTAPI_RESPONSE_CACHE_HPP
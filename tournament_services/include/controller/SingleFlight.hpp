@@ -0,0 +1,71 @@
+#ifndef RESTAPI_SINGLE_FLIGHT_HPP
+#define RESTAPI_SINGLE_FLIGHT_HPP
+
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// Coalesces identical concurrent work: the first caller for a key runs it, callers arriving while it is in
+// flight wait for and share the same result (or exception). Nothing is remembered once the call completes;
+// the ResponseCache is what keeps results across requests.
+//
+// The result is shared across worker threads, so it must own plain heap memory: copy anything read from the
+// request arena into it before returning.
+template<typename Result>
+class SingleFlight {
+    using SharedResult = std::shared_ptr<const Result>;
+
+    struct Call {
+        std::shared_future<SharedResult> result;
+        std::size_t followers = 0;
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Call> calls;
+
+public:
+    template<typename Work>
+    SharedResult Do(const std::string& key, Work&& work) {
+        std::promise<SharedResult> promise;
+        std::unique_lock lock(mutex);
+        if (const auto it = calls.find(key); it != calls.end()) {
+            ++it->second.followers;
+            const auto inFlight = it->second.result;
+            lock.unlock();
+            return inFlight.get();
+        }
+        calls.emplace(key, Call{promise.get_future().share()});
+        lock.unlock();
+
+        try {
+            auto result = std::make_shared<const Result>(std::forward<Work>(work)());
+            promise.set_value(result);
+            Forget(key);
+            return result;
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            Forget(key);
+            throw;
+        }
+    }
+
+    // Callers currently waiting on the key's flight, besides the one running it.
+    std::size_t Followers(const std::string& key) const {
+        std::lock_guard lock(mutex);
+        const auto it = calls.find(key);
+        return it == calls.end() ? 0 : it->second.followers;
+    }
+
+private:
+    void Forget(const std::string& key) {
+        std::lock_guard lock(mutex);
+        calls.erase(key);
+    }
+};
+
+#endif //RESTAPI_SINGLE_FLIGHT_HPP
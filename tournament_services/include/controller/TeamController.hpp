@@ -8,20 +8,24 @@
 #include <string>
 #include <crow.h>
 #include <nlohmann/json.hpp>
+#include <cstddef>
 #include <memory>
-#include <regex>
 
 #include "delegate/ITeamDelegate.hpp"
 #include "domain/Constants.hpp"
 
 class TeamController {
+    static constexpr std::size_t MAX_BULK_TEAMS = 1000;
+
     std::shared_ptr<ITeamDelegate> teamDelegate;
 public:
     explicit TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate);
 
-    [[nodiscard]] crow::response getTeam(const std::string& teamId) const;
-    [[nodiscard]] crow::response getAllTeams() const;
+    [[nodiscard]] crow::response getTeam(const crow::request& request, const std::string& teamId) const;
+    [[nodiscard]] crow::response getAllTeams(const crow::request& request) const;
     [[nodiscard]] crow::response createTeam(const crow::request& request) const;
+    // POST /teams/bulk: a JSON array or NDJSON (one team per line), inserted together
+    [[nodiscard]] crow::response createTeams(const crow::request& request) const;
     [[nodiscard]] crow::response updateTeam(const crow::request& request, const std::string& teamId) const;
     [[nodiscard]] crow::response deleteTeam(const std::string& teamId) const;
 };
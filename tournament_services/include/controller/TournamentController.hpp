@@ -5,7 +5,6 @@
 #ifndef TOURNAMENTS_TOURNAMENTCONTROLLER_HPP
 #define TOURNAMENTS_TOURNAMENTCONTROLLER_HPP
 
-#include <regex>
 #include <memory>
 #include <crow.h>
 
@@ -18,10 +17,10 @@ public:
     TournamentController(const std::shared_ptr<ITournamentDelegate>& delegate);
     ~TournamentController();
 
-    crow::response getTournament(const std::string& tournamentId);
+    crow::response getTournament(const crow::request& request, const std::string& tournamentId);
     crow::response updateTournament(const crow::request& request, const std::string& tournamentId);
     crow::response CreateTournament(const crow::request& request);
-    crow::response ReadAll();
+    crow::response ReadAll(const crow::request& request);
     crow::response deleteTournament(const std::string& tournamentId);
 };
 
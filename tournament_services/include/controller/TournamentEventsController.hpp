@@ -0,0 +1,32 @@
+#ifndef RESTAPI_TOURNAMENT_EVENTS_CONTROLLER_HPP
+#define RESTAPI_TOURNAMENT_EVENTS_CONTROLLER_HPP
+
+#include <chrono>
+#include <crow.h>
+#include <memory>
+#include <string>
+
+#include "configuration/AsyncResponse.hpp"
+#include "delegate/ITournamentDelegate.hpp"
+#include "events/TournamentEventHub.hpp"
+
+// GET /tournaments/{id}/events as Server-Sent Events. Each request is held open until the tournament's channel
+// has something after Last-Event-ID, so a change is sent as soon as it commits, or for at most HOLD_TIMEOUT,
+// which then answers with just the current id. Crow sends a response only once it ends, so every answer ends
+// the request and EventSource reconnects after RETRY. Reads never touch the database; only the viewer that
+// opens a channel checks that the tournament exists.
+class TournamentEventsController {
+    std::shared_ptr<ITournamentDelegate> tournamentDelegate;
+    std::shared_ptr<events::TournamentEventHub> hub;
+public:
+    static constexpr auto RETRY = std::chrono::milliseconds(500);
+    // keep-alive, well inside haproxy's 50 s server timeout
+    static constexpr auto HOLD_TIMEOUT = std::chrono::seconds(25);
+
+    TournamentEventsController(const std::shared_ptr<ITournamentDelegate>& tournamentDelegate,
+                               const std::shared_ptr<events::TournamentEventHub>& hub);
+
+    void getEvents(const crow::request& request, const AsyncResponse& response, const std::string& tournamentId) const;
+};
+
+#endif //RESTAPI_TOURNAMENT_EVENTS_CONTROLLER_HPP
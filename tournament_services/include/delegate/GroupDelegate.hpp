@@ -5,7 +5,6 @@
 #include <string_view>
 #include <memory>
 #include <expected>
-#include <regex>
 
 #include "IGroupDelegate.hpp"
 #include "domain/Group.hpp"
@@ -25,7 +24,8 @@ class GroupDelegate : public IGroupDelegate{
 public:
     GroupDelegate(const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer);
     std::expected<std::shared_ptr<domain::Group>, Error> GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) override;
-    std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GetGroups(const std::string_view& tournamentId) override;
+    std::expected<std::vector<domain::Group>, Error> GetGroups(const std::string_view& tournamentId) override;
+    std::expected<std::string, Error> GetGroupsJson(const std::string_view& tournamentId) override;
     std::expected<std::string, Error> CreateGroup(const std::string_view& tournamentId, const domain::Group& group) override;
     std::expected<void, Error> UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, const std::string_view& groupId) override;
     std::expected<void, Error> UpdateTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& team) override;
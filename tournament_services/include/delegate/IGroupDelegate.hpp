@@ -13,7 +13,9 @@ class IGroupDelegate{
     public:
     virtual ~IGroupDelegate() = default;
     virtual std::expected<std::shared_ptr<domain::Group>, Error> GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
-    virtual std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GetGroups(const std::string_view& tournamentId) = 0;
+    virtual std::expected<std::vector<domain::Group>, Error> GetGroups(const std::string_view& tournamentId) = 0;
+    // JSON array rendered by the database, for clients that take JSON
+    virtual std::expected<std::string, Error> GetGroupsJson(const std::string_view& tournamentId) = 0;
     virtual std::expected<std::string, Error> CreateGroup(const std::string_view& tournamentId, const domain::Group& group) = 0;
     virtual std::expected<void, Error> UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, const std::string_view& groupId) = 0;
     virtual std::expected<void, Error> UpdateTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& teams) = 0;
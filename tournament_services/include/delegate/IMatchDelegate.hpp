@@ -6,15 +6,32 @@
 #include <vector>
 #include <string>
 #include <expected>
+#include <memory_resource>
 
+#include "domain/Bracket.hpp"
+#include "domain/Fields.hpp"
 #include "domain/Match.hpp"
 #include "exception/Error.hpp"
+#include "serialization/FieldSet.hpp"
 
 class IMatchDelegate {
 public:
     virtual ~IMatchDelegate() = default;
     virtual std::expected<std::shared_ptr<domain::Match>, Error> GetMatch(std::string_view tournamentId, std::string_view matchId) = 0;
-    virtual std::expected<std::vector<std::shared_ptr<domain::Match>>, Error> GetMatches(std::string_view tournamentId) = 0;
+    // Only the members in fields are fetched (?fields=); the others keep their defaults. The list lives in the
+    // request arena: encode it within the request
+    virtual std::expected<std::pmr::vector<domain::Match>, Error> GetMatches(std::string_view tournamentId,
+                                                                        const serialization::FieldSet<domain::Match>& fields) = 0;
+    // JSON array rendered by the database, for clients that take JSON
+    virtual std::expected<std::string, Error> GetMatchesJson(std::string_view tournamentId,
+                                                             const serialization::FieldSet<domain::Match>& fields) = 0;
+    // Version of the tournament's match list, cheap enough to check on every poll
+    virtual std::expected<std::string, Error> GetMatchesVersion(std::string_view tournamentId) = 0;
+    // Every match arranged by section and round, teams resolved; one query however many teams there are
+    virtual std::expected<domain::Bracket, Error> GetBracket(std::string_view tournamentId) = 0;
     virtual std::expected<std::string, Error> UpdateMatchScore(const domain::Match& match) = 0;
+    // Set-based UpdateMatchScore for queued submissions: one write and one broker message for the whole list.
+    // Results are per match, in input order; match ids must be distinct.
+    virtual std::vector<std::expected<std::string, Error>> UpdateMatchScores(const std::vector<domain::Match>& matches) = 0;
 };
 #endif /* RESTAPI_IMATCH_DELEGATE_HPP */
\ No newline at end of file
@@ -15,8 +15,12 @@ public:
     virtual ~ITeamDelegate() = default;
 
     virtual std::expected<std::shared_ptr<domain::Team>, Error> GetTeam(std::string_view id) = 0;
-    virtual std::expected<std::vector<std::shared_ptr<domain::Team>>, Error> GetAllTeams() = 0;
+    virtual std::expected<std::vector<domain::Team>, Error> GetAllTeams() = 0;
+    // JSON array rendered by the database, for clients that take JSON
+    virtual std::expected<std::string, Error> GetAllTeamsJson() = 0;
     virtual std::expected<std::string, Error> CreateTeam(const domain::Team& team) = 0;
+    // One id or error per team, in input order; a duplicate name fails only its own item
+    virtual std::expected<std::vector<std::expected<std::string, Error>>, Error> CreateTeams(const std::vector<domain::Team>& teams) = 0;
     virtual std::expected<std::string, Error> UpdateTeam(const domain::Team& team) = 0;
     virtual std::expected<void, Error> DeleteTeam(std::string_view id) = 0;
 };
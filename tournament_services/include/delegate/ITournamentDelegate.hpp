@@ -18,7 +18,7 @@ class ITournamentDelegate {
 public:
     virtual ~ITournamentDelegate() = default;
 
-    virtual std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error> ReadAll() = 0;
+    virtual std::expected<std::vector<domain::Tournament>, Error> ReadAll() = 0;
 
     virtual std::expected<std::shared_ptr<domain::Tournament>, Error> GetTournament(std::string_view id) = 0;
     virtual std::expected<std::string, Error> CreateTournament(const domain::Tournament& tournament) = 0;
@@ -19,8 +19,14 @@ class MatchDelegate : public IMatchDelegate {
 public:
     explicit MatchDelegate(const std::shared_ptr<IMatchRepository>& matchRepository, const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer);
     std::expected<std::shared_ptr<domain::Match>, Error> GetMatch(std::string_view tournamentId, std::string_view matchId) override;
-    std::expected<std::vector<std::shared_ptr<domain::Match>>, Error> GetMatches(std::string_view tournamentId) override;
+    std::expected<std::pmr::vector<domain::Match>, Error> GetMatches(std::string_view tournamentId,
+                                                                const serialization::FieldSet<domain::Match>& fields) override;
+    std::expected<std::string, Error> GetMatchesJson(std::string_view tournamentId,
+                                                     const serialization::FieldSet<domain::Match>& fields) override;
+    std::expected<std::string, Error> GetMatchesVersion(std::string_view tournamentId) override;
+    std::expected<domain::Bracket, Error> GetBracket(std::string_view tournamentId) override;
     std::expected<std::string, Error> UpdateMatchScore(const domain::Match& match) override;
+    std::vector<std::expected<std::string, Error>> UpdateMatchScores(const std::vector<domain::Match>& matches) override;
 };  
 
 #endif /* RESTAPI_MATCH_DELEGATE_HPP */
\ No newline at end of file
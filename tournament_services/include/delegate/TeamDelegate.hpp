@@ -7,20 +7,22 @@
 #include <expected>
 
 #include "domain/Team.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 #include "exception/Error.hpp"
 #include "delegate/ITeamDelegate.hpp"
 
 class TeamDelegate : public ITeamDelegate { // changed: now implements ITeamDelegate
 public:
-    TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string_view>> repository);
+    TeamDelegate(std::shared_ptr<ITeamRepository> repository);
 
-    std::expected<std::vector<std::shared_ptr<domain::Team>>, Error> GetAllTeams() override;
+    std::expected<std::vector<domain::Team>, Error> GetAllTeams() override;
+    std::expected<std::string, Error> GetAllTeamsJson() override;
     std::expected<std::shared_ptr<domain::Team>, Error> GetTeam(std::string_view id) override;
     std::expected<std::string, Error> CreateTeam(const domain::Team& team) override;
+    std::expected<std::vector<std::expected<std::string, Error>>, Error> CreateTeams(const std::vector<domain::Team>& teams) override;
     std::expected<std::string, Error> UpdateTeam(const domain::Team& team) override;
     std::expected<void, Error> DeleteTeam(std::string_view id) override;
 
 private:
-    std::shared_ptr<IRepository<domain::Team, std::string_view>> teamRepository;
+    std::shared_ptr<ITeamRepository> teamRepository;
 };
\ No newline at end of file
@@ -17,7 +17,7 @@ class TournamentDelegate : public ITournamentDelegate {
 public:
     TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string>> repository);
 
-    std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error> ReadAll() override;
+    std::expected<std::vector<domain::Tournament>, Error> ReadAll() override;
     std::expected<std::shared_ptr<domain::Tournament>, Error> GetTournament(std::string_view id) override;
     std::expected<std::string, Error> CreateTournament(const domain::Tournament& tournament) override;
     std::expected<std::string, Error> UpdateTournament(const domain::Tournament& tournament) override;
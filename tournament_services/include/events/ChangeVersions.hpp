@@ -0,0 +1,58 @@
+#ifndef RESTAPI_CHANGE_VERSIONS_HPP
+#define RESTAPI_CHANGE_VERSIONS_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+// Version of each tournament's matches as seen by the match_changes feed: it moves on every committed match
+// change, from any instance or from the consumer, without a query. Responses cached under it stay valid until
+// the next change (GET /tournaments/{id}/bracket).
+//
+// Only trustworthy while the feed is connected: Version is nullopt otherwise, and a reconnect moves every
+// tournament's version because changes may have been missed in between. Versions carry a per-process token:
+// they are counters, and a tag from another instance or an earlier run must never match.
+namespace events {
+    class ChangeVersions {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, std::uint64_t> changes;
+        std::uint64_t epoch = 0;
+        bool live = false;
+        const std::string instance = [] {
+            std::random_device random;
+            return std::to_string((static_cast<std::uint64_t>(random()) << 32) | random());
+        }();
+
+    public:
+        void Changed(const std::string& tournamentId) {
+            std::lock_guard lock(mutex);
+            ++changes[tournamentId];
+        }
+
+        // Feed (re)connected: anything may have changed while it was down.
+        void Connected() {
+            std::lock_guard lock(mutex);
+            ++epoch;
+            live = true;
+        }
+
+        void Disconnected() {
+            std::lock_guard lock(mutex);
+            live = false;
+        }
+
+        std::optional<std::string> Version(const std::string& tournamentId) const {
+            std::lock_guard lock(mutex);
+            if (!live) {
+                return std::nullopt;
+            }
+            const auto found = changes.find(tournamentId);
+            return instance + "-" + std::to_string(epoch) + "." + std::to_string(found == changes.end() ? 0 : found->second);
+        }
+    };
+}
+
+#endif //RESTAPI_CHANGE_VERSIONS_HPP
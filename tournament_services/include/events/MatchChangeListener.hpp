@@ -0,0 +1,95 @@
+#ifndef RESTAPI_MATCH_CHANGE_LISTENER_HPP
+#define RESTAPI_MATCH_CHANGE_LISTENER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <pqxx/pqxx>
+
+#include "events/ChangeVersions.hpp"
+#include "events/TournamentEventHub.hpp"
+
+// The hub's only feed: one dedicated connection (outside the request pool) LISTENing on match_changes, which
+// a trigger on MATCHES notifies on every insert and update. Notifications arrive once the writing transaction
+// commits, whether the write came from this service or from the consumer advancing the bracket. Each change
+// also moves the tournament's ChangeVersions entry.
+namespace events {
+    class MatchChangeListener {
+        static constexpr auto POLL_INTERVAL = std::chrono::seconds(1);
+        static constexpr auto RECONNECT_DELAY = std::chrono::seconds(2);
+
+        class Receiver : public pqxx::notification_receiver {
+            TournamentEventHub& hub;
+            ChangeVersions& versions;
+        public:
+            Receiver(pqxx::connection& connection, TournamentEventHub& hub, ChangeVersions& versions)
+                : pqxx::notification_receiver(connection, CHANNEL), hub(hub), versions(versions) {}
+
+            void operator()(const std::string& payload, int) override {
+                if (const auto tournamentId = PublishMatchChange(hub, payload)) {
+                    versions.Changed(*tournamentId);
+                }
+            }
+        };
+
+        std::shared_ptr<TournamentEventHub> hub;
+        std::shared_ptr<ChangeVersions> versions;
+        std::string connectionString;
+        std::jthread worker;
+
+        void Run(const std::stop_token& stop) {
+            while (!stop.stop_requested()) {
+                try {
+                    pqxx::connection connection(connectionString);
+                    Receiver receiver(connection, *hub, *versions);
+                    // changes made while we were not listening are gone: viewers have to reload
+                    hub->ResetAll();
+                    versions->Connected();
+                    while (!stop.stop_requested()) {
+                        connection.await_notification(POLL_INTERVAL.count(), 0);
+                        hub->Expire(std::chrono::steady_clock::now());
+                    }
+                } catch (const std::exception& e) {
+                    versions->Disconnected();
+                    std::cerr << "[MatchChangeListener] " << e.what() << ", reconnecting" << std::endl;
+                    // parked viewers still get their keep-alive while the database is unreachable
+                    const auto reconnectAt = std::chrono::steady_clock::now() + RECONNECT_DELAY;
+                    while (!stop.stop_requested() && std::chrono::steady_clock::now() < reconnectAt) {
+                        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                            POLL_INTERVAL, reconnectAt - std::chrono::steady_clock::now()));
+                        hub->Expire(std::chrono::steady_clock::now());
+                    }
+                }
+            }
+            versions->Disconnected();
+        }
+
+    public:
+        static constexpr const char* CHANNEL = "match_changes";
+
+        MatchChangeListener(std::shared_ptr<TournamentEventHub> hub, std::shared_ptr<ChangeVersions> versions,
+                            std::string connectionString)
+            : hub(std::move(hub)), versions(std::move(versions)), connectionString(std::move(connectionString)) {}
+
+        void Start() {
+            worker = std::jthread([this](const std::stop_token& stop) { Run(stop); });
+        }
+
+        // Returns within one POLL_INTERVAL.
+        void Stop() {
+            worker.request_stop();
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+
+        ~MatchChangeListener() { Stop(); }
+    };
+}
+
+#endif //RESTAPI_MATCH_CHANGE_LISTENER_HPP
@@ -0,0 +1,273 @@
+#ifndef RESTAPI_TOURNAMENT_EVENT_HUB_HPP
+#define RESTAPI_TOURNAMENT_EVENT_HUB_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+// Fan-out point for GET /tournaments/{id}/events. A single feed (MatchChangeListener) publishes every
+// committed match change; the hub keeps a short buffer per tournament that someone is watching and every
+// viewer reads from that buffer, so the number of viewers never reaches the database.
+//
+// Channels open with their first viewer and close once nobody has read them for IDLE_TIMEOUT. Changes for
+// tournaments without a channel are dropped on arrival. A viewer with nothing to read yet is parked on its
+// channel and answered by the Publish that brings its next event, or with nothing at its deadline (Expire).
+namespace events {
+    struct Event {
+        std::uint64_t id;
+        std::string type;
+        std::string data;
+    };
+
+    // What a viewer gets on each read. reset means events were lost for it (buffer overrun, channel
+    // reopened, feed reconnected): the client should reload the match list and continue from lastId.
+    struct Backlog {
+        std::vector<Event> events;
+        bool reset = false;
+        std::uint64_t lastId = 0;
+    };
+
+    // Runs once per parked viewer, outside the hub's lock and on whichever thread released it.
+    using Delivery = std::function<void(const Backlog&)>;
+
+    class TournamentEventHub {
+    public:
+        static constexpr std::size_t BUFFER_SIZE = 256;
+        static constexpr auto IDLE_TIMEOUT = std::chrono::minutes(2);
+
+    private:
+        struct Waiter {
+            std::uint64_t lastEventId;
+            std::chrono::steady_clock::time_point deadline;
+            Delivery deliver;
+        };
+
+        struct Channel {
+            std::deque<Event> events;
+            // ids up to here may have been missed by a reader of this channel
+            std::uint64_t lostThrough = 0;
+            std::chrono::steady_clock::time_point lastRead;
+            std::vector<Waiter> waiters;
+        };
+
+        using Deliveries = std::vector<std::pair<Delivery, Backlog>>;
+
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, Channel> channels;
+        // event ids are global, so one Last-Event-ID stays meaningful across channel reopenings
+        std::uint64_t sequence = 0;
+        // set while draining: nobody is parked any more
+        bool released = false;
+
+        Backlog Collect(const Channel& channel, std::uint64_t lastEventId) const {
+            Backlog backlog;
+            backlog.lastId = sequence;
+            if (lastEventId < channel.lostThrough || lastEventId > sequence) {
+                backlog.reset = true;
+                return backlog;
+            }
+            for (const auto& event : channel.events) {
+                if (event.id > lastEventId) {
+                    backlog.events.push_back(event);
+                }
+            }
+            return backlog;
+        }
+
+        // Hands every waiter of the channel what it has to read now.
+        void ReleaseWaiters(Channel& channel, Deliveries& deliveries) const {
+            for (auto& waiter : channel.waiters) {
+                deliveries.emplace_back(std::move(waiter.deliver), Collect(channel, waiter.lastEventId));
+            }
+            channel.waiters.clear();
+        }
+
+        static void Deliver(Deliveries& deliveries) {
+            for (auto& [deliver, backlog] : deliveries) {
+                deliver(backlog);
+            }
+        }
+
+    public:
+        bool IsOpen(const std::string& tournamentId) const {
+            std::lock_guard lock(mutex);
+            return channels.contains(tournamentId);
+        }
+
+        void Open(const std::string& tournamentId, std::chrono::steady_clock::time_point now) {
+            std::lock_guard lock(mutex);
+            auto [channel, opened] = channels.try_emplace(tournamentId);
+            if (opened) {
+                channel->second.lostThrough = sequence;
+                channel->second.lastRead = now;
+            }
+        }
+
+        void Publish(const std::string& tournamentId, std::string type, std::string data) {
+            Deliveries deliveries;
+            {
+                std::lock_guard lock(mutex);
+                const auto channel = channels.find(tournamentId);
+                if (channel == channels.end()) {
+                    return;
+                }
+                auto& events = channel->second.events;
+                events.push_back({++sequence, std::move(type), std::move(data)});
+                if (events.size() > BUFFER_SIZE) {
+                    channel->second.lostThrough = events.front().id;
+                    events.pop_front();
+                }
+                ReleaseWaiters(channel->second, deliveries);
+            }
+            Deliver(deliveries);
+        }
+
+        // The feed may have missed changes (reconnect): every open channel starts over.
+        void ResetAll() {
+            Deliveries deliveries;
+            {
+                std::lock_guard lock(mutex);
+                for (auto& [tournamentId, channel] : channels) {
+                    channel.events.clear();
+                    channel.lostThrough = sequence;
+                    ReleaseWaiters(channel, deliveries);
+                }
+            }
+            Deliver(deliveries);
+        }
+
+        // Events after lastEventId; without one the viewer starts from now. nullopt if the channel is not open.
+        std::optional<Backlog> Since(const std::string& tournamentId, std::optional<std::uint64_t> lastEventId,
+                                     std::chrono::steady_clock::time_point now) {
+            std::lock_guard lock(mutex);
+            const auto found = channels.find(tournamentId);
+            if (found == channels.end()) {
+                return std::nullopt;
+            }
+            Channel& channel = found->second;
+            channel.lastRead = now;
+            return Collect(channel, lastEventId.value_or(sequence));
+        }
+
+        // Since, but a viewer with nothing to read is parked until its next event or deadline instead of being
+        // answered empty. deliver runs exactly once, right here if there is something to send already.
+        // false (and deliver never runs) if the channel is not open.
+        bool Await(const std::string& tournamentId, std::optional<std::uint64_t> lastEventId,
+                   std::chrono::steady_clock::time_point now, std::chrono::steady_clock::time_point deadline,
+                   Delivery deliver) {
+            Backlog backlog;
+            {
+                std::lock_guard lock(mutex);
+                const auto found = channels.find(tournamentId);
+                if (found == channels.end()) {
+                    return false;
+                }
+                Channel& channel = found->second;
+                channel.lastRead = now;
+                const auto from = lastEventId.value_or(sequence);
+                backlog = Collect(channel, from);
+                if (!released && !backlog.reset && backlog.events.empty()) {
+                    channel.waiters.push_back({from, deadline, std::move(deliver)});
+                    return true;
+                }
+            }
+            deliver(backlog);
+            return true;
+        }
+
+        // Answers parked viewers whose deadline passed and closes channels nobody has read for IDLE_TIMEOUT;
+        // a parked viewer keeps its channel open.
+        void Expire(std::chrono::steady_clock::time_point now) {
+            Deliveries deliveries;
+            {
+                std::lock_guard lock(mutex);
+                for (auto& [tournamentId, channel] : channels) {
+                    for (auto& waiter : channel.waiters) {
+                        if (waiter.deadline <= now) {
+                            deliveries.emplace_back(std::move(waiter.deliver), Collect(channel, waiter.lastEventId));
+                            channel.lastRead = now;
+                        }
+                    }
+                    std::erase_if(channel.waiters, [now](const Waiter& waiter) { return waiter.deadline <= now; });
+                }
+                std::erase_if(channels, [now](const auto& entry) {
+                    return entry.second.waiters.empty() && now - entry.second.lastRead > IDLE_TIMEOUT;
+                });
+            }
+            Deliver(deliveries);
+        }
+
+        // Shutdown: answers every parked viewer now and parks no more, so held streams do not hold up the drain.
+        void ReleaseAll() {
+            Deliveries deliveries;
+            {
+                std::lock_guard lock(mutex);
+                released = true;
+                for (auto& [tournamentId, channel] : channels) {
+                    ReleaseWaiters(channel, deliveries);
+                }
+            }
+            Deliver(deliveries);
+        }
+
+        std::size_t Waiting() const {
+            std::lock_guard lock(mutex);
+            std::size_t waiting = 0;
+            for (const auto& [tournamentId, channel] : channels) {
+                waiting += channel.waiters.size();
+            }
+            return waiting;
+        }
+
+        std::size_t OpenChannels() const {
+            std::lock_guard lock(mutex);
+            return channels.size();
+        }
+    };
+
+    // Payload of the match_changes notification (see database/db_script.sql):
+    // {"tournamentId": "...", "match": {...stored document, "id": "..."}}. Returns the tournament the change
+    // belongs to; malformed payloads are ignored.
+    inline std::optional<std::string> PublishMatchChange(TournamentEventHub& hub, std::string_view payload) {
+        const auto change = nlohmann::json::parse(payload, nullptr, false);
+        if (change.is_discarded() || !change.is_object()) {
+            return std::nullopt;
+        }
+        const auto tournamentId = change.find("tournamentId");
+        const auto match = change.find("match");
+        if (tournamentId == change.end() || !tournamentId->is_string() || match == change.end()) {
+            return std::nullopt;
+        }
+        auto id = tournamentId->get<std::string>();
+        hub.Publish(id, "match", match->dump());
+        return id;
+    }
+
+    // text/event-stream body: a retry hint, then the events. A reset is its own event; the id line at the end
+    // moves the client's Last-Event-ID forward even when nothing happened.
+    inline std::string RenderEventStream(const Backlog& backlog, std::chrono::milliseconds retry) {
+        std::string body = "retry: " + std::to_string(retry.count()) + "\n\n";
+        if (backlog.reset) {
+            body += "event: reset\ndata: {}\n\n";
+        }
+        for (const auto& event : backlog.events) {
+            body += "id: " + std::to_string(event.id) + "\nevent: " + event.type + "\ndata: " + event.data + "\n\n";
+        }
+        if (backlog.events.empty() || backlog.events.back().id != backlog.lastId) {
+            body += "id: " + std::to_string(backlog.lastId) + "\n\n";
+        }
+        return body;
+    }
+}
+
+#endif //RESTAPI_TOURNAMENT_EVENT_HUB_HPP
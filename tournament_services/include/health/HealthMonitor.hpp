@@ -0,0 +1,117 @@
+#ifndef RESTAPI_HEALTH_MONITOR_HPP
+#define RESTAPI_HEALTH_MONITOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Dependency status behind GET /health/ready. A background thread runs every check once per interval and
+// caches the outcome, so probes from the load balancer only read a snapshot. A check that hangs does not
+// hang the probe: once the last completed round is older than STALE_AFTER intervals, the instance reports
+// not ready.
+//
+// Draining is one-way: once BeginDraining is called readiness stays down, so the load balancer stops sending
+// new requests while the ones in flight finish.
+namespace health {
+    struct Check {
+        std::string name;
+        std::function<bool()> probe;
+    };
+
+    struct DependencyStatus {
+        std::string name;
+        bool up = false;
+    };
+
+    struct Snapshot {
+        bool ready = false;
+        bool draining = false;
+        std::vector<DependencyStatus> dependencies;
+    };
+
+    class HealthMonitor {
+    public:
+        static constexpr int STALE_AFTER = 3;
+
+    private:
+        const std::vector<Check> checks;
+        const std::chrono::milliseconds interval;
+
+        mutable std::mutex mutex;
+        std::vector<DependencyStatus> dependencies;
+        // no completed round yet: not ready
+        std::chrono::steady_clock::time_point checkedAt{};
+        std::atomic<bool> draining = false;
+        std::jthread worker;
+
+        void Run(const std::stop_token& stop) {
+            std::mutex sleepMutex;
+            std::condition_variable_any sleep;
+            while (!stop.stop_requested()) {
+                CheckNow();
+                std::unique_lock lock(sleepMutex);
+                sleep.wait_for(lock, stop, interval, [] { return false; });
+            }
+        }
+
+    public:
+        HealthMonitor(std::vector<Check> checks, std::chrono::milliseconds interval)
+            : checks(std::move(checks)), interval(interval) {}
+
+        void Start() {
+            worker = std::jthread([this](const std::stop_token& stop) { Run(stop); });
+        }
+
+        void Stop() {
+            worker.request_stop();
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+
+        ~HealthMonitor() { Stop(); }
+
+        // One round of checks, outside the lock; a throwing check counts as down.
+        void CheckNow() {
+            std::vector<DependencyStatus> results;
+            results.reserve(checks.size());
+            for (const auto& check : checks) {
+                bool up = false;
+                try {
+                    up = check.probe();
+                } catch (const std::exception&) {
+                }
+                results.push_back({check.name, up});
+            }
+            std::lock_guard lock(mutex);
+            dependencies = std::move(results);
+            checkedAt = std::chrono::steady_clock::now();
+        }
+
+        void BeginDraining() { draining = true; }
+
+        [[nodiscard]] bool Draining() const { return draining; }
+
+        [[nodiscard]] Snapshot Current(std::chrono::steady_clock::time_point now) const {
+            Snapshot snapshot;
+            snapshot.draining = draining;
+            std::lock_guard lock(mutex);
+            snapshot.dependencies = dependencies;
+            const bool fresh = checkedAt != std::chrono::steady_clock::time_point{}
+                && now - checkedAt <= interval * STALE_AFTER;
+            snapshot.ready = !snapshot.draining && fresh
+                && std::ranges::all_of(dependencies, [](const DependencyStatus& dependency) { return dependency.up; });
+            return snapshot;
+        }
+    };
+}
+
+#endif //RESTAPI_HEALTH_MONITOR_HPP
@@ -0,0 +1,345 @@
+#ifndef RESTAPI_METRICS_HPP
+#define RESTAPI_METRICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+// Process metrics in Prometheus text format. Every worker thread records into its own shard of relaxed atomic
+// counters that only it writes, so recording is a handful of plain loads and stores with no lock and no shared
+// cache line; a scrape takes the registry lock once and sums the shards.
+namespace metrics {
+    // Upper bounds in microseconds; the last bucket is +Inf.
+    constexpr std::array<std::uint64_t, 14> LATENCY_BUCKETS = {
+        500, 1'000, 2'500, 5'000, 10'000, 25'000, 50'000, 100'000, 250'000, 500'000, 1'000'000, 2'500'000, 5'000'000, 10'000'000};
+
+    // Codes this service answers with get their own series; anything else is counted as "other".
+    constexpr std::array<int, 16> STATUS_CODES = {200, 201, 202, 204, 304, 400, 401, 403, 404, 405, 409, 422, 429, 500, 503, 504};
+
+    // Routes are registered at startup; the shards are sized for all of them up front.
+    constexpr std::size_t MAX_ROUTES = 64;
+
+    using RouteId = std::size_t;
+
+    namespace detail {
+        // Single writer per counter: a relaxed load and store is enough and avoids a locked RMW.
+        inline void Add(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        struct Histogram {
+            std::array<std::atomic<std::uint64_t>, LATENCY_BUCKETS.size() + 1> buckets{};
+            std::atomic<std::uint64_t> sumMicros = 0;
+
+            void Observe(std::uint64_t micros) {
+                const auto bucket = std::lower_bound(LATENCY_BUCKETS.begin(), LATENCY_BUCKETS.end(), micros) - LATENCY_BUCKETS.begin();
+                Add(buckets[bucket], 1);
+                Add(sumMicros, micros);
+            }
+        };
+
+        struct RouteSeries {
+            Histogram latency;
+            std::array<std::atomic<std::uint64_t>, STATUS_CODES.size() + 1> statuses{};
+        };
+
+        struct Shard {
+            std::array<RouteSeries, MAX_ROUTES> routes{};
+            std::atomic<std::int64_t> inFlight = 0;
+            std::array<std::atomic<std::uint64_t>, 2> shed{};
+            Histogram brokerSend;
+        };
+
+        // Scrape-side sums.
+        struct HistogramTotals {
+            std::array<std::uint64_t, LATENCY_BUCKETS.size() + 1> buckets{};
+            std::uint64_t sumMicros = 0;
+
+            void Add(const Histogram& histogram) {
+                for (std::size_t i = 0; i < buckets.size(); ++i) {
+                    buckets[i] += histogram.buckets[i].load(std::memory_order_relaxed);
+                }
+                sumMicros += histogram.sumMicros.load(std::memory_order_relaxed);
+            }
+        };
+
+        inline std::size_t StatusIndex(int code) {
+            const auto it = std::find(STATUS_CODES.begin(), STATUS_CODES.end(), code);
+            return static_cast<std::size_t>(it - STATUS_CODES.begin());
+        }
+
+        inline void AppendSeconds(std::string& out, std::uint64_t micros) {
+            out += std::to_string(micros / 1'000'000);
+            const auto fraction = micros % 1'000'000;
+            if (fraction != 0) {
+                std::string digits = std::to_string(fraction);
+                digits.insert(0, 6 - digits.size(), '0');
+                digits.erase(digits.find_last_not_of('0') + 1);
+                out += '.';
+                out += digits;
+            }
+        }
+
+        inline void AppendHistogram(std::string& out, std::string_view name, std::string_view labels, const HistogramTotals& totals) {
+            std::uint64_t cumulative = 0;
+            for (std::size_t i = 0; i < totals.buckets.size(); ++i) {
+                cumulative += totals.buckets[i];
+                out += name;
+                out += "_bucket{";
+                out += labels;
+                if (!labels.empty()) {
+                    out += ',';
+                }
+                out += "le=\"";
+                if (i < LATENCY_BUCKETS.size()) {
+                    AppendSeconds(out, LATENCY_BUCKETS[i]);
+                } else {
+                    out += "+Inf";
+                }
+                out += "\"} " + std::to_string(cumulative) + '\n';
+            }
+            const std::string labelSet = labels.empty() ? std::string() : "{" + std::string(labels) + "}";
+            out += std::string(name) + "_sum" + labelSet + ' ';
+            AppendSeconds(out, totals.sumMicros);
+            out += '\n';
+            out += std::string(name) + "_count" + labelSet + ' ' + std::to_string(cumulative) + '\n';
+        }
+
+        inline std::string Escape(std::string_view value) {
+            std::string escaped;
+            escaped.reserve(value.size());
+            for (const char c : value) {
+                if (c == '\\' || c == '"' || c == '\n') {
+                    escaped += '\\';
+                }
+                escaped += c == '\n' ? 'n' : c;
+            }
+            return escaped;
+        }
+    }
+
+    enum class RequestClass { READ, WRITE };
+
+    class Registry {
+        struct Route {
+            std::string method;
+            std::string path;
+        };
+
+        mutable std::mutex mutex;
+        std::vector<Route> routes;
+        std::vector<std::shared_ptr<detail::Shard>> shards;
+
+        // One per process: the per-thread shard pointer below is not tied to an instance.
+        Registry() = default;
+
+    public:
+        static Registry& Instance() {
+            static Registry registry;
+            return registry;
+        }
+
+        // Called once per route while binding; the id indexes every shard's route series.
+        RouteId RegisterRoute(std::string method, std::string path) {
+            std::lock_guard lock(mutex);
+            if (routes.size() == MAX_ROUTES) {
+                throw std::length_error("metrics::MAX_ROUTES is too small for the registered routes");
+            }
+            routes.push_back({std::move(method), std::move(path)});
+            return routes.size() - 1;
+        }
+
+        // The calling thread's shard, registered on first use and kept after the thread exits so its counts
+        // are never lost.
+        detail::Shard& ForThread() {
+            thread_local detail::Shard* shard = [this] {
+                auto created = std::make_shared<detail::Shard>();
+                std::lock_guard lock(mutex);
+                shards.push_back(created);
+                return created.get();
+            }();
+            return *shard;
+        }
+
+        void ObserveRequest(RouteId route, int status, std::chrono::microseconds elapsed) {
+            auto& series = ForThread().routes[route];
+            series.latency.Observe(static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0)));
+            detail::Add(series.statuses[detail::StatusIndex(status)], 1);
+        }
+
+        void RequestStarted() {
+            auto& inFlight = ForThread().inFlight;
+            inFlight.store(inFlight.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        void RequestFinished() {
+            auto& inFlight = ForThread().inFlight;
+            inFlight.store(inFlight.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        }
+
+        void RequestShed(RequestClass requestClass) {
+            detail::Add(ForThread().shed[static_cast<std::size_t>(requestClass)], 1);
+        }
+
+        void ObserveBrokerSend(std::chrono::microseconds elapsed) {
+            ForThread().brokerSend.Observe(static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0)));
+        }
+
+        // Prometheus text exposition format 0.0.4.
+        std::string Render(const std::shared_ptr<IDbConnectionProvider>& pool) const {
+            std::vector<Route> routesSnapshot;
+            std::vector<detail::HistogramTotals> latencies;
+            std::vector<std::array<std::uint64_t, STATUS_CODES.size() + 1>> statuses;
+            std::int64_t inFlight = 0;
+            std::array<std::uint64_t, 2> shed{};
+            detail::HistogramTotals brokerSend;
+            {
+                std::lock_guard lock(mutex);
+                routesSnapshot = routes;
+                latencies.resize(routes.size());
+                statuses.resize(routes.size());
+                for (const auto& shard : shards) {
+                    for (std::size_t route = 0; route < routes.size(); ++route) {
+                        latencies[route].Add(shard->routes[route].latency);
+                        for (std::size_t i = 0; i < statuses[route].size(); ++i) {
+                            statuses[route][i] += shard->routes[route].statuses[i].load(std::memory_order_relaxed);
+                        }
+                    }
+                    inFlight += shard->inFlight.load(std::memory_order_relaxed);
+                    for (std::size_t i = 0; i < shed.size(); ++i) {
+                        shed[i] += shard->shed[i].load(std::memory_order_relaxed);
+                    }
+                    brokerSend.Add(shard->brokerSend);
+                }
+            }
+
+            std::string out;
+            out.reserve(16 * 1024);
+            out += "# HELP http_request_duration_seconds Handler latency by route template.\n";
+            out += "# TYPE http_request_duration_seconds histogram\n";
+            for (std::size_t route = 0; route < routesSnapshot.size(); ++route) {
+                const std::string labels = "method=\"" + detail::Escape(routesSnapshot[route].method) + "\",route=\""
+                    + detail::Escape(routesSnapshot[route].path) + "\"";
+                detail::AppendHistogram(out, "http_request_duration_seconds", labels, latencies[route]);
+            }
+
+            out += "# HELP http_responses_total Responses by route template and status code.\n";
+            out += "# TYPE http_responses_total counter\n";
+            for (std::size_t route = 0; route < routesSnapshot.size(); ++route) {
+                for (std::size_t i = 0; i < statuses[route].size(); ++i) {
+                    if (statuses[route][i] == 0) {
+                        continue;
+                    }
+                    out += "http_responses_total{method=\"" + detail::Escape(routesSnapshot[route].method) + "\",route=\""
+                        + detail::Escape(routesSnapshot[route].path) + "\",status=\""
+                        + (i < STATUS_CODES.size() ? std::to_string(STATUS_CODES[i]) : std::string("other")) + "\"} "
+                        + std::to_string(statuses[route][i]) + '\n';
+                }
+            }
+
+            out += "# HELP http_requests_in_flight Requests currently inside a handler.\n";
+            out += "# TYPE http_requests_in_flight gauge\n";
+            out += "http_requests_in_flight " + std::to_string(std::max<std::int64_t>(inFlight, 0)) + '\n';
+
+            out += "# HELP http_requests_shed_total Requests rejected by admission control.\n";
+            out += "# TYPE http_requests_shed_total counter\n";
+            out += "http_requests_shed_total{class=\"read\"} " + std::to_string(shed[0]) + '\n';
+            out += "http_requests_shed_total{class=\"write\"} " + std::to_string(shed[1]) + '\n';
+
+            if (pool) {
+                const auto statistics = pool->Statistics();
+                out += "# HELP db_pool_connections Database connections by state.\n";
+                out += "# TYPE db_pool_connections gauge\n";
+                out += "db_pool_connections{state=\"idle\"} " + std::to_string(statistics.idle) + '\n';
+                out += "db_pool_connections{state=\"in_use\"} " + std::to_string(statistics.size - std::min(statistics.idle, statistics.size)) + '\n';
+                out += "# HELP db_pool_waiting Threads waiting for a database connection.\n";
+                out += "# TYPE db_pool_waiting gauge\n";
+                out += "db_pool_waiting " + std::to_string(statistics.waiting) + '\n';
+                out += "# HELP db_pool_wait_seconds Moving average of the wait for a database connection.\n";
+                out += "# TYPE db_pool_wait_seconds gauge\n";
+                out += "db_pool_wait_seconds ";
+                detail::AppendSeconds(out, static_cast<std::uint64_t>(std::max<std::int64_t>(statistics.averageWait.count(), 0)));
+                out += '\n';
+            }
+
+            out += "# HELP broker_send_duration_seconds Time to send one message to the broker.\n";
+            out += "# TYPE broker_send_duration_seconds histogram\n";
+            detail::AppendHistogram(out, "broker_send_duration_seconds", "", brokerSend);
+            return out;
+        }
+    };
+
+    // Status and latency of a request whose response is completed after its handler returns (REGISTER_ASYNC_ROUTE),
+    // recorded once by whichever copy finishes it, on whatever thread. A request dropped unfinished (its handler
+    // threw) counts as a 500, which is what Crow answers with.
+    class PendingRequest {
+        struct State {
+            RouteId route;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            std::atomic<bool> finished = false;
+
+            explicit State(RouteId route) : route(route) {}
+
+            void Finish(int status) {
+                if (!finished.exchange(true)) {
+                    Registry::Instance().ObserveRequest(route, status,
+                        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+                }
+            }
+
+            ~State() { Finish(500); }
+        };
+
+        std::shared_ptr<State> state;
+
+    public:
+        explicit PendingRequest(RouteId route) : state(std::make_shared<State>(route)) {}
+
+        void Finish(int status) const { state->Finish(status); }
+    };
+
+    // Runs a route handler, recording its latency, status and the in-flight gauge. A handler that throws is
+    // counted as a 500, which is what Crow answers with. A void handler completes its response later: only the
+    // in-flight gauge is kept here, its status and latency go through a PendingRequest.
+    template<typename Handler>
+    auto ObserveRoute(RouteId route, Handler&& handler) {
+        auto& registry = Registry::Instance();
+        const auto start = std::chrono::steady_clock::now();
+        registry.RequestStarted();
+        const auto elapsed = [&] {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        };
+        try {
+            if constexpr (std::is_void_v<std::invoke_result_t<Handler>>) {
+                std::forward<Handler>(handler)();
+                registry.RequestFinished();
+            } else {
+                auto response = std::forward<Handler>(handler)();
+                registry.RequestFinished();
+                registry.ObserveRequest(route, response.code, elapsed());
+                return response;
+            }
+        } catch (...) {
+            registry.RequestFinished();
+            if constexpr (!std::is_void_v<std::invoke_result_t<Handler>>) {
+                registry.ObserveRequest(route, 500, elapsed());
+            }
+            throw;
+        }
+    }
+}
+
+#endif //RESTAPI_METRICS_HPP
@@ -0,0 +1,166 @@
+#ifndef RESTAPI_ADMISSION_CONTROL_HPP
+#define RESTAPI_ADMISSION_CONTROL_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <crow.h>
+
+#include "metrics/Metrics.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+// Bounds the requests in flight per route class so overload turns into immediate 503s instead of a queue
+// inside PostgresConnectionProvider::Connection(). Reads and writes have separate budgets: a flood of polls
+// can exhaust the read budget, never the slots score updates need.
+//
+// Crow runs handlers on a fixed number of threads, and a request only reaches admission once it holds one.
+// Reads are therefore capped at that number minus the writes minimum: however many polls wait on the pool,
+// that many threads stay free to admit a write.
+//
+// Each limit moves between its minimum and maximum following the pool: while the average wait for a
+// connection is above the target it shrinks by a quarter, once the wait falls under half the target it grows
+// back one slot at a time. Adjustments happen at most every ADJUST_INTERVAL.
+namespace admission {
+    enum class RouteClass { READ, WRITE };
+
+    struct Budget {
+        int minimum;
+        int maximum;
+    };
+
+    // Health probes and metrics scrapes are never shed: overload is exactly when they are needed. Event streams
+    // are not counted either: they wait on the hub rather than the pool, and parked viewers would otherwise
+    // hold the whole read budget.
+    inline std::optional<RouteClass> Classify(const crow::request& request) {
+        if (request.url.starts_with("/health") || request.url == "/metrics") {
+            return std::nullopt;
+        }
+        if (request.method == crow::HTTPMethod::Get && request.url.starts_with("/tournaments/")
+            && request.url.ends_with("/events")) {
+            return std::nullopt;
+        }
+        if (request.method == crow::HTTPMethod::Get || request.method == crow::HTTPMethod::Head) {
+            return RouteClass::READ;
+        }
+        return RouteClass::WRITE;
+    }
+
+    class AdmissionController {
+        static constexpr auto ADJUST_INTERVAL = std::chrono::milliseconds(100);
+
+        struct Gate {
+            std::atomic<int> inFlight = 0;
+            std::atomic<int> limit = 0;
+            Budget budget{};
+        };
+
+        std::array<Gate, 2> gates;
+        std::shared_ptr<IDbConnectionProvider> pool;
+        std::chrono::microseconds targetWait;
+        std::atomic<std::chrono::steady_clock::rep> nextAdjustment = 0;
+        std::atomic<std::int64_t> observedWaitMicros = 0;
+
+        Gate& GateFor(RouteClass routeClass) { return gates[static_cast<std::size_t>(routeClass)]; }
+        const Gate& GateFor(RouteClass routeClass) const { return gates[static_cast<std::size_t>(routeClass)]; }
+
+    public:
+        // handlerThreads: the server's concurrency; budgets above what it can run are lowered to fit.
+        AdmissionController(std::shared_ptr<IDbConnectionProvider> pool, Budget reads, Budget writes, int handlerThreads,
+                            std::chrono::microseconds targetWait)
+            : pool(std::move(pool)), targetWait(targetWait) {
+            writes.maximum = std::clamp(writes.maximum, 1, std::max(1, handlerThreads));
+            writes.minimum = std::clamp(writes.minimum, 1, writes.maximum);
+            reads.maximum = std::clamp(reads.maximum, 1, std::max(1, handlerThreads - writes.minimum));
+            reads.minimum = std::clamp(reads.minimum, 1, reads.maximum);
+            for (const auto routeClass : {RouteClass::READ, RouteClass::WRITE}) {
+                Gate& gate = GateFor(routeClass);
+                gate.budget = routeClass == RouteClass::READ ? reads : writes;
+                gate.limit = gate.budget.maximum;
+            }
+        }
+
+        bool TryAcquire(RouteClass routeClass) {
+            Adapt(std::chrono::steady_clock::now());
+            Gate& gate = GateFor(routeClass);
+            if (gate.inFlight.fetch_add(1, std::memory_order_acq_rel) >= gate.limit.load(std::memory_order_relaxed)) {
+                gate.inFlight.fetch_sub(1, std::memory_order_acq_rel);
+                return false;
+            }
+            return true;
+        }
+
+        void Release(RouteClass routeClass) {
+            GateFor(routeClass).inFlight.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        // One thread per interval samples the pool and moves the limits.
+        void Adapt(std::chrono::steady_clock::time_point now) {
+            auto due = nextAdjustment.load(std::memory_order_relaxed);
+            const auto ticks = now.time_since_epoch().count();
+            if (ticks < due || !nextAdjustment.compare_exchange_strong(due, (now + ADJUST_INTERVAL).time_since_epoch().count())) {
+                return;
+            }
+            const auto wait = pool->Statistics().averageWait;
+            observedWaitMicros.store(wait.count(), std::memory_order_relaxed);
+            for (Gate& gate : gates) {
+                const int limit = gate.limit.load(std::memory_order_relaxed);
+                if (wait > targetWait) {
+                    gate.limit.store(std::max(gate.budget.minimum, limit - std::max(1, limit / 4)), std::memory_order_relaxed);
+                } else if (wait < targetWait / 2) {
+                    gate.limit.store(std::min(gate.budget.maximum, limit + 1), std::memory_order_relaxed);
+                }
+            }
+        }
+
+        int Limit(RouteClass routeClass) const { return GateFor(routeClass).limit.load(std::memory_order_relaxed); }
+        int InFlight(RouteClass routeClass) const { return GateFor(routeClass).inFlight.load(std::memory_order_relaxed); }
+
+        // Whole seconds until a retry has a fair chance: the pool wait last observed, at least one.
+        int RetryAfterSeconds() const {
+            const auto waitSeconds = (observedWaitMicros.load(std::memory_order_relaxed) + 999'999) / 1'000'000;
+            return static_cast<int>(std::clamp<std::int64_t>(waitSeconds, 1, 30));
+        }
+    };
+}
+
+// Crow middleware in front of every handler. Runs right after drain tracking, so rejected requests cost no
+// parsing, reads or compression; left unconfigured (no controller) it admits everything.
+struct AdmissionMiddleware {
+    struct context {
+        std::optional<admission::RouteClass> admitted;
+    };
+
+    std::shared_ptr<admission::AdmissionController> controller;
+
+    void before_handle(crow::request& request, crow::response& response, context& context) {
+        const auto routeClass = admission::Classify(request);
+        if (!controller || !routeClass) {
+            return;
+        }
+        if (!controller->TryAcquire(*routeClass)) {
+            metrics::Registry::Instance().RequestShed(
+                *routeClass == admission::RouteClass::READ ? metrics::RequestClass::READ : metrics::RequestClass::WRITE);
+            response.code = crow::SERVICE_UNAVAILABLE;
+            response.set_header("Retry-After", std::to_string(controller->RetryAfterSeconds()));
+            response.end();
+            return;
+        }
+        context.admitted = routeClass;
+    }
+
+    void after_handle(crow::request&, crow::response&, context& context) {
+        if (context.admitted) {
+            controller->Release(*context.admitted);
+            context.admitted.reset();
+        }
+    }
+};
+
+#endif //RESTAPI_ADMISSION_CONTROL_HPP
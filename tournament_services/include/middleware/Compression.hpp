@@ -0,0 +1,201 @@
+#ifndef RESTAPI_COMPRESSION_HPP
+#define RESTAPI_COMPRESSION_HPP
+
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <crow.h>
+#include <zlib.h>
+
+// Content-coding of response bodies (gzip or deflate, per Accept-Encoding). Bodies under MIN_SIZE are sent as
+// is: below a kilobyte the headers dominate and compression only costs CPU.
+namespace compression {
+    enum class Coding { IDENTITY, GZIP, DEFLATE };
+
+    constexpr std::size_t MIN_SIZE = 1024;
+
+    // zlib's default trade-off; bodies that get polled are compressed once and cached.
+    constexpr int LEVEL = 6;
+
+    constexpr std::string_view Name(Coding coding) {
+        switch (coding) {
+            case Coding::GZIP: return "gzip";
+            case Coding::DEFLATE: return "deflate";
+            default: return "identity";
+        }
+    }
+
+    namespace detail {
+        inline std::string_view Trim(std::string_view value) {
+            const auto first = value.find_first_not_of(" \t");
+            if (first == std::string_view::npos) {
+                return {};
+            }
+            return value.substr(first, value.find_last_not_of(" \t") - first + 1);
+        }
+
+        inline bool EqualsIgnoreCase(std::string_view left, std::string_view right) {
+            if (left.size() != right.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < left.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(left[i])) != std::tolower(static_cast<unsigned char>(right[i]))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // One zlib stream per coding and worker thread, reset between bodies instead of reallocated.
+        class Deflater {
+            z_stream stream{};
+            bool ready = false;
+
+        public:
+            explicit Deflater(int windowBits) {
+                ready = deflateInit2(&stream, LEVEL, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+            }
+
+            ~Deflater() {
+                if (ready) {
+                    deflateEnd(&stream);
+                }
+            }
+
+            Deflater(const Deflater&) = delete;
+            Deflater& operator=(const Deflater&) = delete;
+
+            bool Compress(std::string_view input, std::string& output) {
+                if (!ready || deflateReset(&stream) != Z_OK) {
+                    return false;
+                }
+                output.resize(deflateBound(&stream, static_cast<uLong>(input.size())));
+                stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+                stream.avail_in = static_cast<uInt>(input.size());
+                stream.next_out = reinterpret_cast<Bytef*>(output.data());
+                stream.avail_out = static_cast<uInt>(output.size());
+                if (deflate(&stream, Z_FINISH) != Z_STREAM_END) {
+                    return false;
+                }
+                output.resize(stream.total_out);
+                return true;
+            }
+
+            static Deflater& ForThread(Coding coding) {
+                // windowBits 15 + 16 writes the gzip wrapper; plain 15 is the zlib format HTTP calls deflate
+                thread_local Deflater gzip(15 + 16);
+                thread_local Deflater deflate(15);
+                return coding == Coding::GZIP ? gzip : deflate;
+            }
+        };
+    }
+
+    // Highest q wins, gzip on ties; "*" stands for any coding not listed and q=0 rules a coding out.
+    inline Coding Negotiate(std::string_view acceptEncoding) {
+        double gzip = -1;
+        double deflate = -1;
+        double any = -1;
+        while (!acceptEncoding.empty()) {
+            const auto comma = acceptEncoding.find(',');
+            std::string_view item = acceptEncoding.substr(0, comma);
+            acceptEncoding = comma == std::string_view::npos ? std::string_view{} : acceptEncoding.substr(comma + 1);
+
+            double quality = 1;
+            const auto semicolon = item.find(';');
+            if (semicolon != std::string_view::npos) {
+                const auto parameter = detail::Trim(item.substr(semicolon + 1));
+                if (parameter.size() > 2 && (parameter[0] == 'q' || parameter[0] == 'Q') && parameter[1] == '=') {
+                    std::from_chars(parameter.data() + 2, parameter.data() + parameter.size(), quality);
+                }
+                item = item.substr(0, semicolon);
+            }
+            item = detail::Trim(item);
+            if (detail::EqualsIgnoreCase(item, "gzip") || detail::EqualsIgnoreCase(item, "x-gzip")) {
+                gzip = quality;
+            } else if (detail::EqualsIgnoreCase(item, "deflate")) {
+                deflate = quality;
+            } else if (item == "*") {
+                any = quality;
+            }
+        }
+        if (gzip < 0) gzip = any;
+        if (deflate < 0) deflate = any;
+
+        if (gzip > 0 && gzip >= deflate) {
+            return Coding::GZIP;
+        }
+        if (deflate > 0) {
+            return Coding::DEFLATE;
+        }
+        return Coding::IDENTITY;
+    }
+
+    inline bool Compress(std::string_view input, Coding coding, std::string& output) {
+        return coding != Coding::IDENTITY && detail::Deflater::ForThread(coding).Compress(input, output);
+    }
+
+    // Strong tags differ per content-coding: "v-json" becomes "v-json-gzip".
+    inline std::string TagFor(std::string_view tag, std::string_view coding) {
+        std::string coded(tag);
+        if (coded.size() >= 2 && coded.back() == '"') {
+            coded.insert(coded.size() - 1, "-" + std::string(coding));
+        }
+        return coded;
+    }
+
+    // Inverse of TagFor, so a client revalidating its compressed copy matches the same version.
+    inline std::string UncodedTag(std::string_view tag) {
+        for (const Coding coding : {Coding::GZIP, Coding::DEFLATE}) {
+            const std::string suffix = "-" + std::string(Name(coding)) + "\"";
+            if (tag.size() > suffix.size() && tag.ends_with(suffix)) {
+                return std::string(tag.substr(0, tag.size() - suffix.size())) + "\"";
+            }
+        }
+        return std::string(tag);
+    }
+
+    inline void AddVary(crow::response& response) {
+        const std::string& vary = response.get_header_value("vary");
+        if (vary.find("Accept-Encoding") != std::string::npos) {
+            return;
+        }
+        response.set_header("vary", vary.empty() ? "Accept-Encoding" : vary + ", Accept-Encoding");
+    }
+
+    // Compresses the body in place when the client accepts a coding, the body is large enough and the result
+    // is actually smaller; any ETag is rewritten for the coded representation.
+    inline void CompressResponse(const crow::request& request, crow::response& response) {
+        if (response.body.size() < MIN_SIZE || !response.get_header_value("content-encoding").empty()) {
+            return;
+        }
+        AddVary(response);
+        const Coding coding = Negotiate(request.get_header_value("Accept-Encoding"));
+        std::string compressed;
+        if (!Compress(response.body, coding, compressed) || compressed.size() >= response.body.size()) {
+            return;
+        }
+        response.body = std::move(compressed);
+        response.set_header("content-encoding", std::string(Name(coding)));
+        const std::string& tag = response.get_header_value("etag");
+        if (!tag.empty()) {
+            response.set_header("etag", TagFor(tag, Name(coding)));
+        }
+    }
+}
+
+// Crow middleware applying CompressResponse to every handler's response. Responses that already carry a
+// Content-Encoding (bodies compressed once and cached by a controller) pass through untouched.
+struct CompressionMiddleware {
+    struct context {};
+
+    void before_handle(crow::request&, crow::response&, context&) {}
+
+    void after_handle(crow::request& request, crow::response& response, context&) {
+        compression::CompressResponse(request, response);
+    }
+};
+
+#endif //RESTAPI_COMPRESSION_HPP
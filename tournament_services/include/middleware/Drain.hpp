@@ -0,0 +1,76 @@
+#ifndef RESTAPI_DRAIN_HPP
+#define RESTAPI_DRAIN_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <crow.h>
+
+#include "health/HealthMonitor.hpp"
+
+// Shutdown support: counts the requests being handled so main can wait for them before stopping the server,
+// and once the instance is draining asks clients (haproxy's keep-alive connections included) to close the
+// connection after the response, so their next request goes to another instance.
+namespace drain {
+    class RequestTracker {
+        mutable std::mutex mutex;
+        std::condition_variable idle;
+        int inFlight = 0;
+
+    public:
+        void Enter() {
+            std::lock_guard lock(mutex);
+            ++inFlight;
+        }
+
+        void Leave() {
+            {
+                std::lock_guard lock(mutex);
+                --inFlight;
+            }
+            idle.notify_all();
+        }
+
+        int InFlight() const {
+            std::lock_guard lock(mutex);
+            return inFlight;
+        }
+
+        // True once nothing is in flight; false if requests are still running at the deadline.
+        bool AwaitIdle(std::chrono::steady_clock::time_point deadline) {
+            std::unique_lock lock(mutex);
+            return idle.wait_until(lock, deadline, [this] { return inFlight == 0; });
+        }
+    };
+}
+
+// First middleware in the chain, so every request is counted, including the ones admission control sheds.
+// Left unconfigured (no tracker) it does nothing.
+struct DrainMiddleware {
+    struct context {
+        bool tracked = false;
+    };
+
+    std::shared_ptr<drain::RequestTracker> tracker;
+    std::shared_ptr<health::HealthMonitor> monitor;
+
+    void before_handle(crow::request&, crow::response&, context& context) {
+        if (tracker) {
+            tracker->Enter();
+            context.tracked = true;
+        }
+    }
+
+    void after_handle(crow::request&, crow::response& response, context& context) {
+        if (monitor && monitor->Draining()) {
+            response.set_header("Connection", "close");
+        }
+        if (context.tracked) {
+            tracker->Leave();
+            context.tracked = false;
+        }
+    }
+};
+
+#endif //RESTAPI_DRAIN_HPP
@@ -1,24 +1,84 @@
 
 #include <activemq/library/ActiveMQCPP.h>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <pthread.h>
+#include <thread>
 
 #include "include/configuration/ContainerSetup.hpp"
 #include "include/configuration/RunConfiguration.hpp"
 #include "include/configuration/RouteDefinition.hpp"
 
-int main() {
-    activemq::library::ActiveMQCPP::initializeLibrary();
-    const auto container = config::containerSetup();
-    crow::SimpleApp app;
+namespace {
+    constexpr auto POOL_CLOSE_TIMEOUT = std::chrono::seconds(5);
+
+    // Serves until SIGTERM or SIGINT, then shuts down in order: readiness goes down while requests are still
+    // served, in-flight requests finish, the server stops, queued score updates are written and published,
+    // and only then are the broker connection and the pool closed. Everything resolved here is released on
+    // return, before the ActiveMQ library shuts down.
+    void Serve(const sigset_t& terminationSignals) {
+        const auto container = config::containerSetup();
+        const auto appConfig = container->resolve<config::RunConfiguration>();
+        const auto healthMonitor = container->resolve<health::HealthMonitor>();
+        const auto requestTracker = std::make_shared<drain::RequestTracker>();
+
+        ServiceApp app;
+        app.get_middleware<DrainMiddleware>().tracker = requestTracker;
+        app.get_middleware<DrainMiddleware>().monitor = healthMonitor;
+        app.get_middleware<AdmissionMiddleware>().controller = container->resolve<admission::AdmissionController>();
+
+        // Bind all annotated routes
+        for (auto& def : routeRegistry()) {
+            def.binder(app, container);
+        }
+
+        container->resolve<events::MatchChangeListener>()->Start();
+        healthMonitor->Start();
+
+        // signals are handled below, not by Crow's immediate stop
+        app.signal_clear();
+        auto server = app.port(appConfig->port)
+            .concurrency(appConfig->concurrency)
+            .run_async();
 
-    // Bind all annotated routes
-    for (auto& def : routeRegistry()) {
-        def.binder(app, container);
+        int signal = 0;
+        sigwait(&terminationSignals, &signal);
+        std::cout << "[main] signal " << signal << " received, draining" << std::endl;
+
+        // Crow cannot stop accepting without cutting the connections it is serving, so new traffic is turned
+        // away by the load balancer instead: it sees /health/ready fail during the grace period.
+        healthMonitor->BeginDraining();
+        std::this_thread::sleep_for(std::chrono::milliseconds(appConfig->shutdownGraceMs));
+        // held event streams would otherwise keep the drain waiting until their keep-alive
+        container->resolve<events::TournamentEventHub>()->ReleaseAll();
+        if (!requestTracker->AwaitIdle(std::chrono::steady_clock::now() + std::chrono::milliseconds(appConfig->drainTimeoutMs))) {
+            std::cerr << "[main] " << requestTracker->InFlight() << " requests still running at the drain deadline" << std::endl;
+        }
+        app.stop();
+        server.wait();
+
+        container->resolve<concurrency::ScoreSubmissionQueue>()->Close();
+        container->resolve<events::MatchChangeListener>()->Stop();
+        healthMonitor->Stop();
+
+        container->resolve<ConnectionManager>()->Close();
+        if (!container->resolve<IDbConnectionProvider>()->Close(POOL_CLOSE_TIMEOUT)) {
+            std::cerr << "[main] database connections still in use at shutdown" << std::endl;
+        }
+        std::cout << "[main] shutdown complete" << std::endl;
     }
+}
 
-    auto appConfig = container->resolve<config::RunConfiguration>();
+int main() {
+    // Blocked before any thread exists so every thread inherits the mask and only sigwait sees them
+    sigset_t terminationSignals;
+    sigemptyset(&terminationSignals);
+    sigaddset(&terminationSignals, SIGTERM);
+    sigaddset(&terminationSignals, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &terminationSignals, nullptr);
 
-    app.port(appConfig->port)
-        .concurrency(appConfig->concurrency)
-        .run();
+    activemq::library::ActiveMQCPP::initializeLibrary();
+    Serve(terminationSignals);
     activemq::library::ActiveMQCPP::shutdownLibrary();
 }
@@ -0,0 +1,223 @@
+#include "controller/BatchController.hpp"
+
+#include <algorithm>
+#include <expected>
+#include <future>
+#include <optional>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/RequestBody.hpp"
+#include "serialization/JsonWriter.hpp"
+
+BatchController::BatchController(const std::shared_ptr<concurrency::WorkerPool>& workers) : workers(workers) {}
+
+namespace {
+  constexpr int FAILED_DEPENDENCY = 424;
+
+  std::optional<crow::HTTPMethod> ParseMethod(std::string_view method) {
+    if (method == "GET") return crow::HTTPMethod::Get;
+    if (method == "POST") return crow::HTTPMethod::Post;
+    if (method == "PUT") return crow::HTTPMethod::Put;
+    if (method == "PATCH") return crow::HTTPMethod::Patch;
+    if (method == "DELETE") return crow::HTTPMethod::Delete;
+    return std::nullopt;
+  }
+
+  std::expected<std::vector<BatchController::Item>, serialization::RequestError> ParseItems(const std::string& body) {
+    const auto document = nlohmann::json::parse(body, nullptr, false);
+    if (document.is_discarded() || !document.is_array()) {
+      return std::unexpected(serialization::RequestError{"", "Body must be a JSON array of requests"});
+    }
+    if (document.empty() || document.size() > BatchController::MAX_ITEMS) {
+      return std::unexpected(serialization::RequestError{"", "A batch holds between 1 and "
+          + std::to_string(BatchController::MAX_ITEMS) + " requests"});
+    }
+
+    std::vector<BatchController::Item> items;
+    items.reserve(document.size());
+    for (std::size_t i = 0; i < document.size(); ++i) {
+      const auto& entry = document[i];
+      const std::string prefix = "[" + std::to_string(i) + "].";
+      if (!entry.is_object()) {
+        return std::unexpected(serialization::RequestError{"[" + std::to_string(i) + "]", "Each request must be an object"});
+      }
+      auto& item = items.emplace_back();
+
+      const auto method = entry.find("method");
+      const auto parsedMethod = method != entry.end() && method->is_string() ? ParseMethod(method->get<std::string>()) : std::nullopt;
+      if (!parsedMethod) {
+        return std::unexpected(serialization::RequestError{prefix + "method", "method must be GET, POST, PUT, PATCH or DELETE"});
+      }
+      item.method = *parsedMethod;
+
+      const auto path = entry.find("path");
+      if (path == entry.end() || !path->is_string() || !path->get_ref<const std::string&>().starts_with('/')) {
+        return std::unexpected(serialization::RequestError{prefix + "path", "path must be an absolute path"});
+      }
+      item.path = path->get<std::string>();
+
+      if (const auto payload = entry.find("body"); payload != entry.end()) {
+        item.body = payload->is_string() ? payload->get<std::string>() : payload->dump();
+        if (!payload->is_string()) {
+          item.headers.emplace_back("Content-Type", "application/json");
+        }
+      }
+
+      if (const auto headers = entry.find("headers"); headers != entry.end()) {
+        if (!headers->is_object()) {
+          return std::unexpected(serialization::RequestError{prefix + "headers", "headers must be an object of strings"});
+        }
+        for (const auto& [name, value] : headers->items()) {
+          if (!value.is_string()) {
+            return std::unexpected(serialization::RequestError{prefix + "headers", "headers must be an object of strings"});
+          }
+          item.headers.emplace_back(name, value.get<std::string>());
+        }
+      }
+
+      if (const auto dependsOn = entry.find("dependsOn"); dependsOn != entry.end()) {
+        if (!dependsOn->is_array()) {
+          return std::unexpected(serialization::RequestError{prefix + "dependsOn", "dependsOn must list earlier request indexes"});
+        }
+        for (const auto& dependency : *dependsOn) {
+          if (!dependency.is_number_unsigned() || dependency.get<std::size_t>() >= i) {
+            return std::unexpected(serialization::RequestError{prefix + "dependsOn", "dependsOn must list earlier request indexes"});
+          }
+          item.dependsOn.push_back(dependency.get<std::size_t>());
+        }
+      }
+    }
+    return items;
+  }
+
+  // Sub-requests always ask for JSON, uncompressed: their bodies are inlined into the batch response, which the
+  // compression middleware handles as a whole.
+  crow::response Dispatch(const BatchController::Item& item) {
+    const auto query = item.path.find('?');
+    std::vector<std::string> parameters;
+    const BoundRoute* route = FindBoundRoute(item.method, std::string_view(item.path).substr(0, query), parameters);
+    if (!route) {
+      return crow::response{crow::NOT_FOUND};
+    }
+    // Checked on the resolved route so "/batch/" or "//batch" cannot get through either: a nested batch would
+    // wait on the worker pool from inside it, and a few of them at once would leave no worker to run anything.
+    if (route->path == "/batch") {
+      return BadRequest({"path", "Batches cannot be nested"});
+    }
+
+    crow::request request;
+    request.method = item.method;
+    request.raw_url = item.path;
+    request.url = item.path.substr(0, query);
+    request.url_params = crow::query_string(item.path);
+    request.body = item.body;
+    for (const auto& [name, value] : item.headers) {
+      if (!compression::detail::EqualsIgnoreCase(name, "Accept") && !compression::detail::EqualsIgnoreCase(name, "Accept-Encoding")) {
+        request.add_header(name, value);
+      }
+    }
+    request.add_header("Accept", "application/json");
+
+    // whatever is thrown, as Crow would answer a handler that throws
+    try {
+      return route->handler(request, parameters);
+    } catch (...) {
+      return crow::response{crow::INTERNAL_SERVER_ERROR};
+    }
+  }
+
+  void WriteResult(serialization::JsonWriter& writer, const crow::response& response) {
+    writer.BeginObject();
+    writer.Key("status").Int(response.code);
+    writer.Key("headers").BeginObject();
+    for (const auto& [name, value] : response.headers) {
+      if (!compression::detail::EqualsIgnoreCase(name, "vary")) {
+        writer.Key(name).String(value);
+      }
+    }
+    writer.EndObject();
+    if (!response.body.empty()) {
+      writer.Key("body");
+      const bool json = response.get_header_value("content-type").starts_with("application/json");
+      if (json && nlohmann::json::accept(response.body)) {
+        writer.Raw(response.body);
+      } else {
+        writer.String(response.body);
+      }
+    }
+    writer.EndObject();
+  }
+}
+
+crow::response BatchController::execute(const crow::request& request) {
+  auto items = ParseItems(request.body);
+  if (!items) {
+    return BadRequest(items.error());
+  }
+
+  const std::size_t count = items->size();
+  std::vector<crow::response> results(count);
+  std::vector<bool> done(count, false);
+  std::size_t finished = 0;
+
+  // Waves: everything whose dependencies are done runs together. dependsOn only points backwards, so every
+  // wave has at least one item.
+  while (finished < count) {
+    std::vector<std::size_t> wave;
+    for (std::size_t i = 0; i < count; ++i) {
+      if (done[i]) {
+        continue;
+      }
+      const auto& dependsOn = (*items)[i].dependsOn;
+      if (!std::ranges::all_of(dependsOn, [&](std::size_t dependency) { return static_cast<bool>(done[dependency]); })) {
+        continue;
+      }
+      if (std::ranges::any_of(dependsOn, [&](std::size_t dependency) { return results[dependency].code >= 400; })) {
+        results[i] = crow::response{FAILED_DEPENDENCY};
+        done[i] = true;
+        ++finished;
+        continue;
+      }
+      wave.push_back(i);
+    }
+
+    // The first item runs on this thread, the rest on the worker pool.
+    std::vector<std::pair<std::size_t, std::future<crow::response>>> pending;
+    for (std::size_t w = 1; w < wave.size(); ++w) {
+      const auto& item = (*items)[wave[w]];
+      pending.emplace_back(wave[w], workers->Submit([&item] { return Dispatch(item); }));
+    }
+    // the submitted items reference items: never unwind past them while they may still run
+    try {
+      if (!wave.empty()) {
+        results[wave.front()] = Dispatch((*items)[wave.front()]);
+      }
+    } catch (...) {
+      for (auto& [index, future] : pending) {
+        future.wait();
+      }
+      throw;
+    }
+    for (auto& [index, future] : pending) {
+      results[index] = future.get();
+    }
+    for (const auto index : wave) {
+      done[index] = true;
+      ++finished;
+    }
+  }
+
+  crow::response response{crow::OK};
+  serialization::JsonWriter writer(response.body);
+  writer.BeginArray();
+  for (const auto& result : results) {
+    WriteResult(writer, result);
+  }
+  writer.EndArray();
+  response.add_header("content-type", "application/json");
+  return response;
+}
+
+REGISTER_ROUTE(BatchController, execute, "/batch", "POST"_method)
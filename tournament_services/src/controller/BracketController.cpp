@@ -0,0 +1,72 @@
+#include "controller/BracketController.hpp"
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/ResponseBody.hpp"
+#include "domain/Constants.hpp"
+#include "domain/Utilities.hpp"
+
+BracketController::BracketController(const std::shared_ptr<IMatchDelegate>& matchDelegate,
+                                     const std::shared_ptr<events::ChangeVersions>& versions)
+    : matchDelegate(matchDelegate), versions(versions) {}
+
+namespace {
+  int mapErrorToStatus(const Error err) {
+    switch (err) {
+      case Error::NOT_FOUND: return crow::NOT_FOUND;
+      case Error::INVALID_FORMAT: return crow::BAD_REQUEST;
+      default: return crow::INTERNAL_SERVER_ERROR;
+    }
+  }
+}
+
+// Shared by every identical request arriving while it runs: one query and one render per burst.
+std::expected<BracketController::RenderedBracket, Error> BracketController::renderBracket(
+    const crow::request& request, const std::string& tournamentId, const std::string& version, const std::string& cacheKey) {
+  if (auto body = responseCache.Find(cacheKey, version)) {
+    return RenderedBracket{std::move(body)};
+  }
+
+  auto bracket = matchDelegate->GetBracket(tournamentId);
+  if (!bracket) {
+    return std::unexpected(bracket.error());
+  }
+  auto response = EncodedResponse(request, *bracket);
+  // Stored under the version read before the query: a change committed meanwhile has already moved the
+  // version on, so this entry is simply never hit.
+  return RenderedBracket{StoreResponse(responseCache, cacheKey, version, request, response)};
+}
+
+crow::response BracketController::getBracket(const crow::request& request, const std::string& tournamentId) {
+  // versions, cache and flights are keyed by the id as the change feed reports it
+  const std::string id = domain::CanonicalId(tournamentId);
+  // read before anything else, see renderBracket
+  const auto version = versions->Version(id);
+  if (!version) {
+    auto bracket = matchDelegate->GetBracket(tournamentId);
+    if (!bracket) {
+      return crow::response{mapErrorToStatus(bracket.error())};
+    }
+    return EncodedResponse(request, *bracket);
+  }
+
+  const auto encoding = serialization::NegotiateEncoding(request.get_header_value("Accept"));
+  const std::string tag = EntityTag(*version, encoding);
+  // the version is in memory, so a client that holds it costs nothing, cached body or not
+  if (auto matched = IfNoneMatch(request, tag)) {
+    return NotModified(*matched);
+  }
+
+  const auto coding = compression::Negotiate(request.get_header_value("Accept-Encoding"));
+  const std::string cacheKey = id + "/bracket/" + std::string(serialization::ContentType(encoding))
+      + "/" + std::string(compression::Name(coding));
+
+  // the version is part of the flight: a request that saw a newer one must not get an older body
+  const auto rendered = bracketFlights.Do(cacheKey + "@" + *version,
+                                          [&] { return renderBracket(request, id, *version, cacheKey); });
+  if (!*rendered) {
+    return crow::response{mapErrorToStatus(rendered->error())};
+  }
+  return CachedResponse(encoding, *(*rendered)->body, tag);
+}
+
+REGISTER_ROUTE(BracketController, getBracket, "/tournaments/<string>/bracket", "GET"_method)
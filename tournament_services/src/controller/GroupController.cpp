@@ -10,6 +10,8 @@
 #include "exception/NotFound.hpp"
 #include "exception/InvalidFormat.hpp"
 #include "exception/Error.hpp"
+#include "controller/RequestBody.hpp"
+#include "controller/ResponseBody.hpp"
 #include <iostream>
 
 GroupController::GroupController(const std::shared_ptr<IGroupDelegate>& delegate) : groupDelegate(std::move(delegate)) {}
@@ -28,33 +30,79 @@ static int mapErrorToStatus(const Error err) {
   }
 }
 
-crow::response GroupController::GetGroups(const std::string& tournamentId){
+namespace {
+    using serialization::FieldRule;
+    using serialization::JsonReader;
+    using serialization::Presence;
+    using serialization::RequestError;
+
+    bool ReadTeamId(JsonReader& r, domain::Team& t, RequestError& e) {
+        return serialization::ReadStringField(r, t.Id, e);
+    }
+
+    bool ReadTeamName(JsonReader& r, domain::Team& t, RequestError& e) {
+        return serialization::ReadStringField(r, t.Name, e);
+    }
+
+    // Teams embedded in a group body, both members optional as before
+    constexpr FieldRule<domain::Team> GROUP_TEAM_SCHEMA[] = {
+        {"id", Presence::OPTIONAL, ReadTeamId, "id must be a string"},
+        {"name", Presence::OPTIONAL, ReadTeamName, "name must be a string"},
+    };
+
+    // POST /tournaments/{id}/groups and PATCH /tournaments/{id}/groups/{id}
+    constexpr FieldRule<domain::Group> GROUP_SCHEMA[] = {
+        {"name", Presence::REQUIRED,
+            [](JsonReader& r, domain::Group& g, RequestError& e) { return serialization::ReadStringField(r, g.Name(), e); },
+            "name is required and must be a string"},
+        {"id", Presence::OPTIONAL,
+            [](JsonReader& r, domain::Group& g, RequestError& e) { return serialization::ReadStringField(r, g.Id(), e); },
+            "id must be a string"},
+        {"tournamentId", Presence::OPTIONAL,
+            [](JsonReader& r, domain::Group& g, RequestError& e) { return serialization::ReadStringField(r, g.TournamentId(), e); },
+            "tournamentId must be a string"},
+        {"teams", Presence::OPTIONAL,
+            [](JsonReader& r, domain::Group& g, RequestError& e) { return serialization::DecodeArray<domain::Team>(r, g.Teams(), GROUP_TEAM_SCHEMA, e); },
+            "teams must be an array of teams"},
+    };
+
+    // PATCH /tournaments/{id}/groups/{id}/teams, an array of these
+    constexpr FieldRule<domain::Team> ADD_TEAM_SCHEMA[] = {
+        {"id", Presence::REQUIRED, ReadTeamId, "id is required and must be a string"},
+        {"name", Presence::OPTIONAL, ReadTeamName, "name must be a string"},
+    };
+}
+
+crow::response GroupController::GetGroups(const crow::request& request, const std::string& tournamentId){
+    if (WantsJson(request)) {
+        auto document = this->groupDelegate->GetGroupsJson(tournamentId);
+        if (!document) {
+            return crow::response{ mapErrorToStatus(document.error()), "Error" };
+        }
+        return RenderedJsonResponse(std::move(*document));
+    }
     auto groups = this->groupDelegate->GetGroups(tournamentId);
     if (groups) {
-        const nlohmann::json body = *groups;
-        crow::response response{crow::OK, body.dump()};
-        response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-        return response;
+        return EncodedResponse(request, *groups, 3072);
     }
     return crow::response{ mapErrorToStatus(groups.error()), "Error" };
 }
 
-crow::response GroupController::GetGroup(const std::string& tournamentId, const std::string& groupId){
+crow::response GroupController::GetGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId){
     auto result = this->groupDelegate->GetGroup(tournamentId, groupId);
     if (result) {
-        const nlohmann::json body = *result;
-        crow::response response{crow::OK, body.dump()};
-        response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-        return response;
+        return EncodedResponse(request, *result);
     }
     return crow::response{ mapErrorToStatus(result.error()), "Error" };
 }
 
 crow::response GroupController::CreateGroup(const crow::request& request, const std::string& tournamentId){
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Group group = requestBody;
+    auto group = DecodeBody<domain::Group>(request, GROUP_SCHEMA);
+    if (!group) {
+        return std::move(group.error());
+    }
 
-    auto groupId = groupDelegate->CreateGroup(tournamentId, group);
+    auto groupId = groupDelegate->CreateGroup(tournamentId, *group);
     if (groupId) {
         crow::response response;
         response.add_header("location", *groupId);
@@ -65,10 +113,12 @@ crow::response GroupController::CreateGroup(const crow::request& request, const
 }
 
 crow::response GroupController::UpdateGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId) {
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Group group = requestBody;
+    auto group = DecodeBody<domain::Group>(request, GROUP_SCHEMA);
+    if (!group) {
+        return std::move(group.error());
+    }
 
-    auto result = groupDelegate->UpdateGroup(tournamentId, group, groupId);
+    auto result = groupDelegate->UpdateGroup(tournamentId, *group, groupId);
     if (result) {
         crow::response response{crow::NO_CONTENT};
         return response;
@@ -77,10 +127,12 @@ crow::response GroupController::UpdateGroup(const crow::request& request, const
 }
 
 crow::response GroupController::AddTeams(const crow::request& request, const std::string& tournamentId, const std::string& groupId) {
-    auto requestBody = nlohmann::json::parse(request.body);
-    std::vector<domain::Team> teams = requestBody.get<std::vector<domain::Team>>();
+    auto teams = DecodeArrayBody<domain::Team>(request, ADD_TEAM_SCHEMA);
+    if (!teams) {
+        return std::move(teams.error());
+    }
 
-    const auto result = groupDelegate->UpdateTeams(tournamentId, groupId, teams);
+    const auto result = groupDelegate->UpdateTeams(tournamentId, groupId, *teams);
     if (result) {
         crow::response response{crow::NO_CONTENT};
         return response;
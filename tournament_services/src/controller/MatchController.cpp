@@ -7,9 +7,13 @@
 #include "configuration/RouteDefinition.hpp"
 #include "domain/Utilities.hpp"
 #include "exception/Error.hpp"
+#include "controller/RequestBody.hpp"
+#include "controller/ResponseBody.hpp"
 #include <iostream>
 
-MatchController::MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate) : matchDelegate(matchDelegate) {}
+MatchController::MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate,
+                                 const std::shared_ptr<concurrency::ScoreSubmissionQueue>& scoreQueue)
+    : matchDelegate(matchDelegate), scoreQueue(scoreQueue) {}
 
 static int mapErrorToStatus(const Error err) {
   switch (err) {
@@ -20,90 +24,184 @@ static int mapErrorToStatus(const Error err) {
   }
 }
 
+namespace {
+  using serialization::FieldRule;
+  using serialization::JsonReader;
+  using serialization::Presence;
+  using serialization::RequestError;
+
+  // ?fields=id,score: absent means every member; an unknown or empty list is a 400
+  std::expected<serialization::FieldSet<domain::Match>, crow::response> RequestedFields(const crow::request& request) {
+    const char* list = request.url_params.get("fields");
+    if (list == nullptr) {
+      return serialization::FieldSet<domain::Match>::All();
+    }
+    auto fields = serialization::FieldSet<domain::Match>::Parse(list);
+    if (!fields) {
+      return std::unexpected(BadRequest({"fields", fields.error().empty()
+          ? std::string("fields must name at least one member")
+          : "Unknown field " + fields.error()}));
+    }
+    return *fields;
+  }
 
-crow::response MatchController::getMatches(const std::string& tournamentId) {
-  auto res = matchDelegate->GetMatches(tournamentId);
-  if (res) {
-    nlohmann::json arr = nlohmann::json::array();
-    for (const auto& matchptr : *res) {
-      if (matchptr) {
-        arr.push_back(*matchptr);
-      } else {
-        arr.push_back(nullptr);
-      }
+  // RFC 7240: the client accepts 202 and polls the operation instead of waiting for the write
+  bool PrefersAsync(const crow::request& request) {
+    return request.get_header_value("Prefer").find("respond-async") != std::string::npos;
+  }
+
+  constexpr std::string_view SCORE_VALUES_MESSAGE = "score must contain integer homeTeamScore and visitorTeamScore";
+
+  bool ReadScoreValue(JsonReader& reader, int& value, RequestError& error) {
+    if (!serialization::ReadIntField(reader, value, error)) {
+      return false;
     }
-    auto response = crow::response{crow::OK, arr.dump()};
-    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-    return response;
-  } else {
-    return crow::response{ mapErrorToStatus(res.error())};
+    if (value < 0) {
+      error.message = "Scores must be non-negative";
+      return false;
+    }
+    return true;
   }
+
+  constexpr FieldRule<domain::Score> SCORE_SCHEMA[] = {
+    {"homeTeamScore", Presence::REQUIRED,
+      [](JsonReader& r, domain::Score& s, RequestError& e) { return ReadScoreValue(r, s.homeTeamScore, e); }, SCORE_VALUES_MESSAGE},
+    {"visitorTeamScore", Presence::REQUIRED,
+      [](JsonReader& r, domain::Score& s, RequestError& e) { return ReadScoreValue(r, s.visitorTeamScore, e); }, SCORE_VALUES_MESSAGE},
+  };
+
+  // PATCH /tournaments/{id}/matches/{id}
+  constexpr FieldRule<domain::Match> MATCH_SCORE_SCHEMA[] = {
+    {"score", Presence::REQUIRED,
+      [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::DecodeObject<domain::Score>(r, m.MatchScore(), SCORE_SCHEMA, e); },
+      "Missing or invalid score object"},
+    {"id", Presence::OPTIONAL,
+      [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::ReadStringField(r, m.Id(), e); }, "id must be a string"},
+    {"tournamentId", Presence::OPTIONAL,
+      [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::ReadStringField(r, m.TournamentId(), e); }, "tournamentId must be a string"},
+    {"name", Presence::OPTIONAL,
+      [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::ReadStringField(r, m.Name(), e); }, "name must be a string"},
+    {"homeTeamId", Presence::OPTIONAL,
+      [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::ReadStringField(r, m.HomeTeamId(), e); }, "homeTeamId must be a string"},
+    {"visitorTeamId", Presence::OPTIONAL,
+      [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::ReadStringField(r, m.VisitorTeamId(), e); }, "visitorTeamId must be a string"},
+  };
 }
 
-crow::response MatchController::getMatch(const std::string& tournamentId, const std::string& matchId) {
-  auto res = matchDelegate->GetMatch(tournamentId, matchId);
-  if (res) {
-    nlohmann::json json = *(*res);
-    auto response = crow::response{crow::OK, json.dump()};
-    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-    return response;
-  } else {
-    return crow::response{ mapErrorToStatus(res.error())};
+// Runs once per burst of identical requests (same tournament, version, representation, fieldset and coding) whose
+// client did not already hold that version: the cache lookup and, on a miss, the read, render and compression are
+// shared by every request waiting on it.
+std::expected<MatchController::RenderedList, Error> MatchController::renderMatches(const crow::request& request, const std::string& tournamentId,
+                                                                                const std::string& version,
+                                                                                serialization::Encoding encoding,
+                                                                                const serialization::FieldSet<domain::Match>& fields,
+                                                                                const std::string& cacheKey) {
+  if (auto body = responseCache.Find(cacheKey, version)) {
+    return RenderedList{std::move(body)};
   }
-}
 
-crow::response MatchController::updateMatchScore(const crow::request& request, const std::string& tournamentId, const std::string& matchId) {
   crow::response response;
-  if (!nlohmann::json::accept(request.body)) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Invalid JSON format";
-    return response;
+  if (encoding == serialization::Encoding::JSON) {
+    auto document = matchDelegate->GetMatchesJson(tournamentId, fields);
+    if (!document) {
+      return std::unexpected(document.error());
+    }
+    response = RenderedJsonResponse(std::move(*document));
+  } else {
+    auto res = matchDelegate->GetMatches(tournamentId, fields);
+    if (!res) {
+      return std::unexpected(res.error());
+    }
+    response = EncodedResponse(request, *res, 192, fields);
   }
+  // Stored under the version read before rendering: if the list changed in between, the body is newer than
+  // its tag and the next poll simply renders again.
+  return RenderedList{StoreResponse(responseCache, cacheKey, version, request, response)};
+}
 
-  auto requestBody = nlohmann::json::parse(request.body);
+crow::response MatchController::getMatches(const crow::request& request, const std::string& tournamentId) {
+  const auto encoding = serialization::NegotiateEncoding(request.get_header_value("Accept"));
+  const auto coding = compression::Negotiate(request.get_header_value("Accept-Encoding"));
+  auto fields = RequestedFields(request);
+  if (!fields) {
+    return std::move(fields.error());
+  }
 
-  // Basic JSON shape validation for score
-  if (!requestBody.contains("score") || !requestBody["score"].is_object()) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Missing or invalid score object";
-    return response;
+  // Checked before anything is read or rendered, and shared by the burst: an unchanged list costs one aggregate
+  // query, and a client that already holds it gets its 304 whether or not this instance has the body cached.
+  const auto version = matchVersionFlights.Do(tournamentId, [&] { return matchDelegate->GetMatchesVersion(tournamentId); });
+  if (!*version) {
+    return crow::response{ mapErrorToStatus(version->error())};
+  }
+  // a sparse list is its own representation: own cache entry and own validator
+  const std::string fieldsSuffix = fields->IsAll() ? "" : "-fields" + fields->Name();
+  const std::string tag = EntityTag(**version + fieldsSuffix, encoding);
+  if (auto matched = IfNoneMatch(request, tag)) {
+    return NotModified(*matched);
   }
 
-  auto& scoreJson = requestBody["score"];
-  if (!scoreJson.contains("homeTeamScore") || !scoreJson.contains("visitorTeamScore") ||
-      !scoreJson["homeTeamScore"].is_number_integer() || !scoreJson["visitorTeamScore"].is_number_integer()) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "score must contain integer homeTeamScore and visitorTeamScore";
-    return response;
+  const std::string cacheKey = tournamentId + "/matches/" + std::string(serialization::ContentType(encoding))
+      + "/" + std::string(compression::Name(coding)) + fieldsSuffix;
+  // the version is part of the flight: a request that saw a newer one must not get an older body
+  const auto rendered = matchListFlights.Do(cacheKey + "@" + **version,
+                                            [&] { return renderMatches(request, tournamentId, **version, encoding, *fields, cacheKey); });
+  if (!*rendered) {
+    return crow::response{ mapErrorToStatus(rendered->error())};
   }
+  return CachedResponse(encoding, *(*rendered)->body, tag);
+}
 
-  int home = scoreJson["homeTeamScore"].get<int>();
-  int visitor = scoreJson["visitorTeamScore"].get<int>();
-  if (home < 0 || visitor < 0) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Scores must be non-negative";
-    return response;
+crow::response MatchController::getMatch(const crow::request& request, const std::string& tournamentId, const std::string& matchId) {
+  auto res = matchDelegate->GetMatch(tournamentId, matchId);
+  if (res) {
+    return EncodedResponse(request, **res);
+  } else {
+    return crow::response{ mapErrorToStatus(res.error())};
   }
+}
 
-  // Deserialize into domain::Match (assumes nlohmann conversion exists)
-  domain::Match matchObj = requestBody;
+crow::response MatchController::updateMatchScore(const crow::request& request, const std::string& tournamentId, const std::string& matchId) {
+  auto decoded = DecodeBody<domain::Match>(request, MATCH_SCORE_SCHEMA);
+  if (!decoded) {
+    return std::move(decoded.error());
+  }
+  domain::Match& matchObj = *decoded;
 
   // Ensure tournamentId matches path or is filled
   if (!matchObj.TournamentId().empty() && matchObj.TournamentId() != tournamentId) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Tournament ID in body does not match path";
-    return response;
+    return BadRequest({"tournamentId", "Tournament ID in body does not match path"});
   }
   matchObj.TournamentId() = tournamentId;
 
   // Allow empty ID (client didn't set it) or ID equal to path; reject otherwise
   if (!matchObj.Id().empty() && matchObj.Id() != matchId) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Match ID in body does not match path";
-    return response;
+    return BadRequest({"id", "Match ID in body does not match path"});
   }
   matchObj.Id() = matchId;
 
+  if (PrefersAsync(request)) {
+    // only the format is checked up front; a missing match shows up as a failed operation
+    if (!domain::IsValidId(tournamentId) || !domain::IsValidId(matchId)) {
+      return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+    }
+    const auto operationId = scoreQueue->Submit(matchObj);
+    if (!operationId) {
+      crow::response busy{crow::SERVICE_UNAVAILABLE};
+      busy.set_header("Retry-After", "1");
+      return busy;
+    }
+    crow::response accepted{crow::ACCEPTED};
+    serialization::JsonWriter writer(accepted.body);
+    writer.BeginObject();
+    writer.Key("operationId").String(*operationId);
+    writer.Key("status").String("pending");
+    writer.EndObject();
+    accepted.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    accepted.add_header("Location", "/operations/" + *operationId);
+    return accepted;
+  }
+
+  crow::response response;
   auto res = matchDelegate->UpdateMatchScore(matchObj);
   if (res) {
     response.code = crow::OK;
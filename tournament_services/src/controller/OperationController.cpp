@@ -0,0 +1,57 @@
+#include "controller/OperationController.hpp"
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/RequestBody.hpp"
+#include "domain/Constants.hpp"
+#include "exception/Error.hpp"
+
+OperationController::OperationController(const std::shared_ptr<concurrency::ScoreSubmissionQueue>& scoreQueue)
+    : scoreQueue(scoreQueue) {}
+
+namespace {
+  // status the synchronous PATCH would have answered with
+  int mapErrorToStatus(const Error err) {
+    switch (err) {
+      case Error::NOT_FOUND: return crow::NOT_FOUND;
+      case Error::INVALID_FORMAT: return crow::BAD_REQUEST;
+      case Error::DUPLICATE: return crow::CONFLICT;
+      default: return crow::INTERNAL_SERVER_ERROR;
+    }
+  }
+
+  std::string_view StatusName(concurrency::OperationStatus status) {
+    switch (status) {
+      case concurrency::OperationStatus::SUCCEEDED: return "succeeded";
+      case concurrency::OperationStatus::FAILED: return "failed";
+      default: return "pending";
+    }
+  }
+}
+
+crow::response OperationController::getOperation(const std::string& operationId) const {
+  if (!domain::IsValidId(operationId)) {
+    return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+  }
+  const auto operation = scoreQueue->Find(operationId);
+  if (!operation) {
+    return crow::response{crow::NOT_FOUND};
+  }
+
+  crow::response response{crow::OK};
+  serialization::JsonWriter writer(response.body);
+  writer.BeginObject();
+  writer.Key("operationId").String(operation->id);
+  writer.Key("status").String(StatusName(operation->status));
+  writer.Key("tournamentId").String(operation->tournamentId);
+  writer.Key("matchId").String(operation->matchId);
+  if (operation->error) {
+    writer.Key("error").BeginObject();
+    writer.Key("status").Int(mapErrorToStatus(*operation->error));
+    writer.EndObject();
+  }
+  writer.EndObject();
+  response.add_header("content-type", "application/json");
+  return response;
+}
+
+REGISTER_ROUTE(OperationController, getOperation, "/operations/<string>", "GET"_method)
@@ -7,6 +7,8 @@
 #include "configuration/RouteDefinition.hpp"
 #include "domain/Utilities.hpp"
 #include "exception/Error.hpp"
+#include "controller/RequestBody.hpp"
+#include "controller/ResponseBody.hpp"
 #include <iostream>
 
 TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate) : teamDelegate(teamDelegate) {}
@@ -20,52 +22,107 @@ static int mapErrorToStatus(const Error err) {
   }
 }
 
-crow::response TeamController::getTeam(const std::string& teamId) const {
-  if (!std::regex_match(teamId, ID_VALUE)) {
+namespace {
+  using serialization::FieldRule;
+  using serialization::JsonReader;
+  using serialization::Presence;
+  using serialization::RequestError;
+
+  bool ReadName(JsonReader& r, domain::Team& t, RequestError& e) {
+    return serialization::ReadStringField(r, t.Name, e);
+  }
+
+  // POST /teams
+  constexpr FieldRule<domain::Team> CREATE_SCHEMA[] = {
+    {"name", Presence::REQUIRED, ReadName, "name is required and must be a string"},
+    {"id", Presence::OPTIONAL,
+      [](JsonReader& r, domain::Team& t, RequestError& e) { return serialization::ReadStringField(r, t.Id, e); },
+      "id must be a string"},
+  };
+
+  constexpr int MULTI_STATUS = 207;
+
+  bool IsNdjson(const crow::request& request) {
+    const auto& contentType = request.get_header_value("Content-Type");
+    return contentType.starts_with("application/x-ndjson") || contentType.starts_with("application/ndjson");
+  }
+
+  // One object per non-empty line; errors point at the team's position like the array form does.
+  std::expected<std::vector<domain::Team>, crow::response> DecodeNdjson(const std::string& body) {
+    std::vector<domain::Team> teams;
+    std::size_t start = 0;
+    while (start < body.size()) {
+      auto end = body.find('\n', start);
+      if (end == std::string::npos) {
+        end = body.size();
+      }
+      std::string_view line(body.data() + start, end - start);
+      if (line.ends_with('\r')) {
+        line.remove_suffix(1);
+      }
+      start = end + 1;
+      if (line.find_first_not_of(" \t") == std::string_view::npos) {
+        continue;
+      }
+      auto team = serialization::DecodeRequest<domain::Team>(line, CREATE_SCHEMA);
+      if (!team) {
+        const std::string position = "[" + std::to_string(teams.size()) + "]";
+        if (team.error().message == serialization::INVALID_JSON) {
+          team.error().field = position;
+        } else {
+          serialization::PrefixField(team.error(), position);
+        }
+        return std::unexpected(BadRequest(team.error()));
+      }
+      teams.push_back(std::move(*team));
+    }
+    return teams;
+  }
+
+  // PATCH /teams/{id}
+  constexpr FieldRule<domain::Team> UPDATE_SCHEMA[] = {
+    {"name", Presence::REQUIRED, ReadName, "name is required and must be a string"},
+    {"id", Presence::FORBIDDEN, nullptr, "ID is not editable"},
+  };
+}
+
+crow::response TeamController::getTeam(const crow::request& request, const std::string& teamId) const {
+  if (!domain::IsValidId(teamId)) {
     return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
   }
 
   auto res = teamDelegate->GetTeam(teamId);
   if (res) {
-    nlohmann::json body = *res;
-    auto response = crow::response{crow::OK, body.dump()};
-    response.add_header("Content-Type", "application/json");
-    return response;
+    return EncodedResponse(request, **res);
   } else {
     return crow::response{ mapErrorToStatus(res.error()), "Error" };
   }
 }
 
-crow::response TeamController::getAllTeams() const {
+crow::response TeamController::getAllTeams(const crow::request& request) const {
+  if (WantsJson(request)) {
+    auto document = teamDelegate->GetAllTeamsJson();
+    if (!document) {
+      return crow::response{ mapErrorToStatus(document.error()), "Error" };
+    }
+    return RenderedJsonResponse(std::move(*document));
+  }
   auto res = teamDelegate->GetAllTeams();
   if (res) {
-    nlohmann::json arr = nlohmann::json::array();
-    for (const auto& teamptr : *res) {
-      if (teamptr) {
-        arr.push_back(*teamptr);
-      } else {
-        arr.push_back(nullptr);
-      }
-    }
-    auto response = crow::response{crow::OK, arr.dump()};
-    response.add_header("Content-Type", "application/json");
-    return response;
+    return EncodedResponse(request, *res, 80);
   } else {
     return crow::response{ mapErrorToStatus(res.error()), "Error" };
   }
 }
 
 crow::response TeamController::createTeam(const crow::request& request) const {
-  crow::response response;
-
-  if (!nlohmann::json::accept(request.body)) {
-    response.code = crow::BAD_REQUEST;
-    return response;
+  auto team = DecodeBody<domain::Team>(request, CREATE_SCHEMA);
+  if (!team) {
+    return std::move(team.error());
   }
-  auto requestBody = nlohmann::json::parse(request.body);
-  domain::Team team = requestBody;
 
-  auto res = teamDelegate->CreateTeam(team);
+  crow::response response;
+  auto res = teamDelegate->CreateTeam(*team);
   if (res) {
     response.code = crow::CREATED;
     response.body = *res;
@@ -78,24 +135,51 @@ crow::response TeamController::createTeam(const crow::request& request) const {
   return response;
 }
 
-crow::response TeamController::updateTeam(const crow::request& request, const std::string& teamId) const {
-  crow::response response;
-  if (!nlohmann::json::accept(request.body)) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Invalid JSON format";
-    return response;
+crow::response TeamController::createTeams(const crow::request& request) const {
+  auto teams = IsNdjson(request) ? DecodeNdjson(request.body) : DecodeArrayBody<domain::Team>(request, CREATE_SCHEMA);
+  if (!teams) {
+    return std::move(teams.error());
+  }
+  if (teams->empty() || teams->size() > MAX_BULK_TEAMS) {
+    return BadRequest({"", "Between 1 and " + std::to_string(MAX_BULK_TEAMS) + " teams are accepted per request"});
   }
 
-  auto requestBody = nlohmann::json::parse(request.body);
-  domain::Team teamObj = requestBody;
+  auto res = teamDelegate->CreateTeams(*teams);
+  if (!res) {
+    return crow::response{ mapErrorToStatus(res.error()), "Error" };
+  }
 
-  if (!teamObj.Id.empty()) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "ID is not editable";
-    return response;
+  // [{"status": 201, "id": "..."}, {"status": 409, "message": "..."}] in request order; 201 only when every
+  // team was created.
+  crow::response response{crow::CREATED};
+  serialization::JsonWriter writer(response.body);
+  writer.BeginArray();
+  for (const auto& item : *res) {
+    writer.BeginObject();
+    if (item) {
+      writer.Key("status").Int(crow::CREATED);
+      writer.Key("id").String(*item);
+    } else {
+      response.code = MULTI_STATUS;
+      writer.Key("status").Int(mapErrorToStatus(item.error()));
+      writer.Key("message").String(item.error() == Error::DUPLICATE ? "Team name already exists" : "Error");
+    }
+    writer.EndObject();
   }
+  writer.EndArray();
+  response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+  return response;
+}
+
+crow::response TeamController::updateTeam(const crow::request& request, const std::string& teamId) const {
+  auto decoded = DecodeBody<domain::Team>(request, UPDATE_SCHEMA);
+  if (!decoded) {
+    return std::move(decoded.error());
+  }
+  domain::Team& teamObj = *decoded;
   teamObj.Id = teamId;
 
+  crow::response response;
   auto res = teamDelegate->UpdateTeam(teamObj);
   if (res) {
     response.code = crow::OK;
@@ -112,7 +196,7 @@ crow::response TeamController::updateTeam(const crow::request& request, const st
 crow::response TeamController::deleteTeam(const std::string& teamId) const {
   crow::response response;
 
-  if (!std::regex_match(teamId, ID_VALUE)) {
+  if (!domain::IsValidId(teamId)) {
     response.code = crow::BAD_REQUEST;
     response.body = "Invalid ID format";
     return response;
@@ -133,5 +217,6 @@ crow::response TeamController::deleteTeam(const std::string& teamId) const {
 REGISTER_ROUTE(TeamController, getTeam, "/teams/<string>", "GET"_method)
 REGISTER_ROUTE(TeamController, getAllTeams, "/teams", "GET"_method)
 REGISTER_ROUTE(TeamController, createTeam, "/teams", "POST"_method)
+REGISTER_ROUTE(TeamController, createTeams, "/teams/bulk", "POST"_method)
 REGISTER_ROUTE(TeamController, updateTeam, "/teams/<string>", "PATCH"_method)
 REGISTER_ROUTE(TeamController, deleteTeam, "/teams/<string>", "DELETE"_method)
@@ -10,6 +10,8 @@
 #include "exception/Error.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Utilities.hpp"
+#include "controller/RequestBody.hpp"
+#include "controller/ResponseBody.hpp"
 
 #include <string>
 #include <utility>
@@ -30,52 +32,84 @@ static int mapErrorToStatus(const Error err) {
     }
 }
 
-crow::response TournamentController::getTournament(const std::string& tournamentId) {
-    if (!std::regex_match(tournamentId, ID_VALUE)) {
+namespace {
+    using serialization::FieldRule;
+    using serialization::JsonReader;
+    using serialization::Presence;
+    using serialization::RequestError;
+
+    constexpr FieldRule<domain::TournamentFormat> FORMAT_SCHEMA[] = {
+        {"maxTeamsPerGroup", Presence::OPTIONAL,
+            [](JsonReader& r, domain::TournamentFormat& f, RequestError& e) { return serialization::ReadIntField(r, f.MaxTeamsPerGroup(), e); },
+            "maxTeamsPerGroup must be an integer"},
+        {"numberOfGroups", Presence::OPTIONAL,
+            [](JsonReader& r, domain::TournamentFormat& f, RequestError& e) { return serialization::ReadIntField(r, f.NumberOfGroups(), e); },
+            "numberOfGroups must be an integer"},
+        {"type", Presence::OPTIONAL,
+            [](JsonReader& r, domain::TournamentFormat& f, RequestError& e) {
+                std::string type;
+                if (!serialization::ReadStringField(r, type, e)) return false;
+                f.Type() = domain::fromString(type);
+                return true;
+            },
+            "type must be a string"},
+    };
+
+    bool ReadName(JsonReader& r, domain::Tournament& t, RequestError& e) {
+        return serialization::ReadStringField(r, t.Name(), e);
+    }
+
+    bool ReadFormat(JsonReader& r, domain::Tournament& t, RequestError& e) {
+        return serialization::DecodeObject<domain::TournamentFormat>(r, t.Format(), FORMAT_SCHEMA, e);
+    }
+
+    // POST /tournaments
+    constexpr FieldRule<domain::Tournament> CREATE_SCHEMA[] = {
+        {"name", Presence::REQUIRED, ReadName, "name is required and must be a string"},
+        {"id", Presence::OPTIONAL,
+            [](JsonReader& r, domain::Tournament& t, RequestError& e) { return serialization::ReadStringField(r, t.Id(), e); },
+            "id must be a string"},
+        {"format", Presence::OPTIONAL, ReadFormat, "format must be an object"},
+    };
+
+    // PATCH /tournaments/{id}
+    constexpr FieldRule<domain::Tournament> UPDATE_SCHEMA[] = {
+        {"name", Presence::REQUIRED, ReadName, "name is required and must be a string"},
+        {"id", Presence::FORBIDDEN, nullptr, "ID is not editable"},
+        {"format", Presence::OPTIONAL, ReadFormat, "format must be an object"},
+    };
+}
+
+crow::response TournamentController::getTournament(const crow::request& request, const std::string& tournamentId) {
+    if (!domain::IsValidId(tournamentId)) {
         return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
     }
 
     auto res = tournamentDelegate->GetTournament(tournamentId);
     if (res) {
-        nlohmann::json body = *res;
-        auto response = crow::response{crow::OK, body.dump()};
-        response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-        return response;
+        return EncodedResponse(request, *res);
     } else {
         return crow::response{mapErrorToStatus(res.error()), "Error"};
     }
 }
 
-crow::response TournamentController::ReadAll() {
+crow::response TournamentController::ReadAll(const crow::request& request) {
     auto res = tournamentDelegate->ReadAll();
     if (res) {
-        nlohmann::json arr = nlohmann::json::array();
-        for (const auto& tournamentptr : *res) {
-            if (tournamentptr) {
-                arr.push_back(*tournamentptr);
-            } else {
-                arr.push_back(nullptr);
-            }
-        }
-        auto response = crow::response{crow::OK, arr.dump()};
-        response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-        return response;
+        return EncodedResponse(request, *res, 128);
     } else {
         return crow::response{mapErrorToStatus(res.error()), "Error"};
     }
 }
 
 crow::response TournamentController::CreateTournament(const crow::request& request) {
-    crow::response response;
-
-    if (!nlohmann::json::accept(request.body)) {
-        response.code = crow::BAD_REQUEST;
-        return response;
+    auto tournament = DecodeBody<domain::Tournament>(request, CREATE_SCHEMA);
+    if (!tournament) {
+        return std::move(tournament.error());
     }
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Tournament tournament = requestBody;
 
-    auto res = tournamentDelegate->CreateTournament(tournament);
+    crow::response response;
+    auto res = tournamentDelegate->CreateTournament(*tournament);
     if (res) {
         response.code = crow::CREATED;
         response.add_header("Location", *res);
@@ -89,23 +123,14 @@ crow::response TournamentController::CreateTournament(const crow::request& reque
 }
 
 crow::response TournamentController::updateTournament(const crow::request& request, const std::string& tournamentId) {
-    crow::response response;
-    if (!nlohmann::json::accept(request.body)) {
-        response.code = crow::BAD_REQUEST;
-        response.body = "Invalid JSON format";
-        return response;
-    }
-
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Tournament tournamentObj = requestBody;
-
-    if (!tournamentObj.Id().empty()) {
-        response.code = crow::BAD_REQUEST;
-        response.body = "ID is not editable";
-        return response;
+    auto decoded = DecodeBody<domain::Tournament>(request, UPDATE_SCHEMA);
+    if (!decoded) {
+        return std::move(decoded.error());
     }
+    domain::Tournament& tournamentObj = *decoded;
     tournamentObj.Id() = tournamentId;
 
+    crow::response response;
     auto res = tournamentDelegate->UpdateTournament(tournamentObj);
     if (res) {
         response.code = crow::NO_CONTENT;
@@ -121,7 +146,7 @@ crow::response TournamentController::updateTournament(const crow::request& reque
 crow::response TournamentController::deleteTournament(const std::string& tournamentId) {
     crow::response response;
 
-    if (!std::regex_match(tournamentId, ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId)) {
         response.code = crow::BAD_REQUEST;
         response.body = "Invalid ID format";
         return response;
@@ -0,0 +1,73 @@
+#include "controller/TournamentEventsController.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "configuration/RouteDefinition.hpp"
+#include "domain/Constants.hpp"
+#include "exception/Error.hpp"
+
+TournamentEventsController::TournamentEventsController(const std::shared_ptr<ITournamentDelegate>& tournamentDelegate,
+                                                       const std::shared_ptr<events::TournamentEventHub>& hub)
+    : tournamentDelegate(tournamentDelegate), hub(hub) {}
+
+namespace {
+  int mapErrorToStatus(const Error err) {
+    switch (err) {
+      case Error::NOT_FOUND: return crow::NOT_FOUND;
+      case Error::INVALID_FORMAT: return crow::BAD_REQUEST;
+      default: return crow::INTERNAL_SERVER_ERROR;
+    }
+  }
+
+  // EventSource sends Last-Event-ID on reconnects; clients that cannot set headers pass ?lastEventId=.
+  std::optional<std::uint64_t> LastEventId(const crow::request& request) {
+    std::string_view value = request.get_header_value("Last-Event-ID");
+    if (value.empty()) {
+      const char* parameter = request.url_params.get("lastEventId");
+      value = parameter ? parameter : "";
+    }
+    std::uint64_t id = 0;
+    const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), id);
+    if (value.empty() || error != std::errc{} || end != value.data() + value.size()) {
+      return std::nullopt;
+    }
+    return id;
+  }
+}
+
+void TournamentEventsController::getEvents(const crow::request& request, const AsyncResponse& response,
+                                           const std::string& tournamentId) const {
+  if (!domain::IsValidId(tournamentId)) {
+    response.End(crow::response{crow::BAD_REQUEST, "Invalid ID format"});
+    return;
+  }
+
+  // may run later, on the thread that publishes the change or expires the wait
+  const auto deliver = [response](const events::Backlog& backlog) {
+    crow::response stream{crow::OK, events::RenderEventStream(backlog, RETRY)};
+    stream.add_header("content-type", "text/event-stream");
+    stream.add_header("cache-control", "no-cache");
+    response.End(std::move(stream));
+  };
+
+  // channels are keyed by the id as the change feed reports it
+  const std::string id = domain::CanonicalId(tournamentId);
+  const auto lastEventId = LastEventId(request);
+  const auto now = std::chrono::steady_clock::now();
+  if (hub->Await(id, lastEventId, now, now + HOLD_TIMEOUT, deliver)) {
+    return;
+  }
+  auto tournament = tournamentDelegate->GetTournament(id);
+  if (!tournament) {
+    response.End(crow::response{mapErrorToStatus(tournament.error()), "Error"});
+    return;
+  }
+  hub->Open(id, now);
+  hub->Await(id, lastEventId, now, now + HOLD_TIMEOUT, deliver);
+}
+
+REGISTER_ASYNC_ROUTE(TournamentEventsController, getEvents, "/tournaments/<string>/events", "GET"_method)
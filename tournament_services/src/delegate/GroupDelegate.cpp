@@ -5,6 +5,7 @@
 #include "exception/Error.hpp"
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <utility>
 #include <sstream>
 #include <iostream>
@@ -14,9 +15,9 @@
 GroupDelegate::GroupDelegate(const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer)
     : tournamentRepository(tournamentRepository), groupRepository(groupRepository), teamRepository(teamRepository), messageProducer(messageProducer){}
 
-std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GroupDelegate::GetGroups(const std::string_view& tournamentId) {
+std::expected<std::vector<domain::Group>, Error> GroupDelegate::GetGroups(const std::string_view& tournamentId) {
     // Validacion de formato de UUID para tournamentId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de existencia del torneo
@@ -33,9 +34,27 @@ std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GroupDelegate:
     }
 }
 
+std::expected<std::string, Error> GroupDelegate::GetGroupsJson(const std::string_view& tournamentId) {
+    // Validacion de formato de UUID para tournamentId
+    if (!domain::IsValidId(tournamentId)) {
+        return std::unexpected(Error::INVALID_FORMAT);
+    }
+    // Validacion de existencia del torneo
+    auto tournament = tournamentRepository->ReadById(tournamentId.data());
+    if (tournament == nullptr) {
+        return std::unexpected(Error::NOT_FOUND);
+    }
+    try {
+        return this->groupRepository->FindByTournamentIdAsJson(tournamentId);
+    } catch (const std::exception& e) {
+        // Error general al leer la base de datos
+        return std::unexpected(Error::UNKNOWN_ERROR);
+    }
+}
+
 std::expected<std::shared_ptr<domain::Group>, Error> GroupDelegate::GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId) || !domain::IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de existencia del torneo 
@@ -58,7 +77,7 @@ std::expected<std::shared_ptr<domain::Group>, Error> GroupDelegate::GetGroup(con
 
 std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_view& tournamentId, const domain::Group& group) {
     // Validacion de formato de UUID para tournamentId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de formato del grupo
@@ -79,7 +98,7 @@ std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_v
     if (!g.Teams().empty()) {
         for (auto& t : g.Teams()) {
             // Validacion de formato UUID de cada equipo
-            if (!std::regex_match(t.Id, ID_VALUE)) {
+            if (!domain::IsValidId(t.Id)) {
                 return std::unexpected(Error::INVALID_FORMAT);
             }
             // Validacion de existencia de cada equipo
@@ -97,7 +116,11 @@ std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_v
             std::unique_ptr<nlohmann::json> message = std::make_unique<nlohmann::json>();
             message->emplace("tournamentId", tournamentId);
             message->emplace("groupId", id);
-            message->emplace("teamId", ""); 
+            std::vector<std::string> teamIds;
+            for (const auto& team : g.Teams()) {
+                teamIds.push_back(team.Id);
+            }
+            message->emplace("teamIds", teamIds);
             messageProducer->SendMessage(message->dump(), "tournament.team-add");
         }
         
@@ -116,7 +139,7 @@ std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_v
 
 std::expected<void, Error> GroupDelegate::UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, const std::string_view& groupId) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId) || !domain::IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de formato del grupo
@@ -154,7 +177,7 @@ std::expected<void, Error> GroupDelegate::UpdateGroup(const std::string_view& to
 }
 std::expected<void, Error> GroupDelegate::RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId) || !domain::IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de existencia del torneo
@@ -177,9 +200,21 @@ std::expected<void, Error> GroupDelegate::RemoveGroup(const std::string_view& to
 
 std::expected<void, Error> GroupDelegate::UpdateTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& teams) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId) || !domain::IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
+    // Validacion de formato UUID de cada equipo y de duplicados dentro de la misma peticion
+    std::vector<std::string> teamIds;
+    teamIds.reserve(teams.size());
+    for (const auto& team : teams) {
+        if (!domain::IsValidId(team.Id)) {
+            return std::unexpected(Error::INVALID_FORMAT);
+        }
+        if (std::ranges::find(teamIds, team.Id) != teamIds.end()) {
+            return std::unexpected(Error::DUPLICATE);
+        }
+        teamIds.push_back(team.Id);
+    }
     // Validacion de existencia del torneo
     auto tournament = tournamentRepository->ReadById(tournamentId.data());
     if (tournament == nullptr) {
@@ -194,30 +229,35 @@ std::expected<void, Error> GroupDelegate::UpdateTeams(const std::string_view& to
     if (group->Teams().size() + teams.size() > 32) {
         return std::unexpected(Error::UNPROCESSABLE_ENTITY);
     }
-    for (const auto& team : teams) {
-        // Validacion de formato UUID de cada equipo
-        if (!std::regex_match(team.Id, ID_VALUE)) {
-            return std::unexpected(Error::INVALID_FORMAT);
-        }
-        // Validacion de duplicados
-        if (groupRepository->FindByGroupIdAndTeamId(groupId, team.Id) != nullptr) {
+    if (teams.empty()) {
+        return {};
+    }
+    try {
+        // Validacion de duplicados: una sola consulta para toda la lista
+        if (!groupRepository->FindTeamIdsInGroup(groupId, teamIds).empty()) {
             return std::unexpected(Error::DUPLICATE);
         }
-        // Validacion de existencia de cada equipo
-        const auto persistedTeam = teamRepository->ReadById(team.Id);
-        if (persistedTeam == nullptr) {
-            return std::unexpected(Error::UNPROCESSABLE_ENTITY);
-        }
-        try {
-            groupRepository->UpdateGroupAddTeam(groupId, persistedTeam);
-            std::unique_ptr<nlohmann::json> message = std::make_unique<nlohmann::json>();
-            message->emplace("tournamentId", tournamentId);
-            message->emplace("groupId", groupId);
-            message->emplace("teamId", team.Id);
-            messageProducer->SendMessage(message->dump(), "tournament.team-add");
-        } catch (const std::exception& e) {
-            return std::unexpected(Error::UNKNOWN_ERROR);
+        // Validacion de existencia de cada equipo: una sola consulta, los miembros se guardan en el orden pedido
+        const auto persistedTeams = teamRepository->ReadByIds(teamIds);
+        std::vector<domain::Team> members;
+        members.reserve(teamIds.size());
+        for (const auto& teamId : teamIds) {
+            const auto persisted = std::ranges::find(persistedTeams, teamId, &domain::Team::Id);
+            if (persisted == persistedTeams.end()) {
+                return std::unexpected(Error::UNPROCESSABLE_ENTITY);
+            }
+            members.push_back(*persisted);
         }
+
+        groupRepository->UpdateGroupAddTeams(groupId, members);
+        // Un solo evento para toda la lista
+        nlohmann::json message;
+        message["tournamentId"] = tournamentId;
+        message["groupId"] = groupId;
+        message["teamIds"] = teamIds;
+        messageProducer->SendMessage(message.dump(), "tournament.team-add");
+    } catch (const std::exception& e) {
+        return std::unexpected(Error::UNKNOWN_ERROR);
     }
     return {};
 }
@@ -1,8 +1,8 @@
 #include "delegate/MatchDelegate.hpp"
 
+#include <algorithm>
 #include <expected>
 #include <iostream>
-#include <regex>
 #include <utility>
 #include <pqxx/pqxx>
 #include <nlohmann/json.hpp>
@@ -13,19 +13,82 @@
 MatchDelegate::MatchDelegate(const std::shared_ptr<IMatchRepository>& matchRepository, const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer)
     : matchRepository(matchRepository), tournamentRepository(tournamentRepository), messageProducer(messageProducer) {}
 
-std::expected<std::vector<std::shared_ptr<domain::Match>>, Error> MatchDelegate::GetMatches(std::string_view tournamentId) {
-    if (!std::regex_match(std::string{tournamentId}, ID_VALUE)) {
+std::expected<std::pmr::vector<domain::Match>, Error> MatchDelegate::GetMatches(std::string_view tournamentId,
+                                                                           const serialization::FieldSet<domain::Match>& fields) {
+    if (!domain::IsValidId(tournamentId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     if (!tournamentRepository->ReadById(tournamentId.data())) {
         return std::unexpected(Error::NOT_FOUND);
     }
-    return matchRepository->FindByTournamentId(tournamentId);
+    return matchRepository->FindByTournamentId(tournamentId, fields);
+}
+
+std::expected<std::string, Error> MatchDelegate::GetMatchesJson(std::string_view tournamentId,
+                                                                const serialization::FieldSet<domain::Match>& fields) {
+    if (!domain::IsValidId(tournamentId)) {
+        return std::unexpected(Error::INVALID_FORMAT);
+    }
+    if (!tournamentRepository->ReadById(tournamentId.data())) {
+        return std::unexpected(Error::NOT_FOUND);
+    }
+    return matchRepository->FindByTournamentIdAsJson(tournamentId, fields);
+}
+
+std::expected<std::string, Error> MatchDelegate::GetMatchesVersion(std::string_view tournamentId) {
+    if (!domain::IsValidId(tournamentId)) {
+        return std::unexpected(Error::INVALID_FORMAT);
+    }
+    auto version = matchRepository->FindVersionByTournamentId(tournamentId);
+    if (!version) {
+        return std::unexpected(Error::NOT_FOUND);
+    }
+    return std::move(*version);
+}
+
+std::expected<domain::Bracket, Error> MatchDelegate::GetBracket(std::string_view tournamentId) {
+    if (!domain::IsValidId(tournamentId)) {
+        return std::unexpected(Error::INVALID_FORMAT);
+    }
+    // the query also tells whether the tournament exists, so there is no separate lookup
+    auto matches = matchRepository->FindBracketByTournamentId(tournamentId);
+    if (!matches) {
+        return std::unexpected(Error::NOT_FOUND);
+    }
+
+    domain::Bracket bracket;
+    bracket.tournamentId = tournamentId;
+    const auto rounds = [](std::size_t starts) {
+        std::vector<domain::BracketRound> sectionRounds(starts - 1);
+        for (std::size_t round = 0; round < sectionRounds.size(); ++round) {
+            sectionRounds[round].number = static_cast<int>(round) + 1;
+        }
+        return sectionRounds;
+    };
+    bracket.winners = rounds(domain::WINNERS_ROUND_STARTS.size());
+    bracket.losers = rounds(domain::LOSERS_ROUND_STARTS.size());
+    bracket.finals = rounds(domain::FINALS_ROUND_STARTS.size());
+
+    // match number order inside each round (W16 before W17), whatever order the rows came in
+    std::ranges::sort(*matches, {}, [](const domain::BracketMatch& match) {
+        return std::pair{match.name.size(), std::string_view(match.name)};
+    });
+    for (auto& match : *matches) {
+        const auto position = domain::ParseBracketPosition(match.name);
+        if (!position) {
+            continue;
+        }
+        auto& section = position->section == domain::BracketSection::WINNERS ? bracket.winners
+                      : position->section == domain::BracketSection::LOSERS ? bracket.losers
+                      : bracket.finals;
+        section[position->round].matches.push_back(std::move(match));
+    }
+    return bracket;
 }
 
 std::expected<std::shared_ptr<domain::Match>, Error> MatchDelegate::GetMatch(std::string_view tournamentId, std::string_view matchId) {
-    if (!std::regex_match(std::string{tournamentId}, ID_VALUE) || 
-        !std::regex_match(std::string{matchId}, ID_VALUE)) {
+    if (!domain::IsValidId(tournamentId) || 
+        !domain::IsValidId(matchId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     if (!tournamentRepository->ReadById(tournamentId.data())) {
@@ -35,8 +98,8 @@ std::expected<std::shared_ptr<domain::Match>, Error> MatchDelegate::GetMatch(std
 }
 
 std::expected<std::string, Error> MatchDelegate::UpdateMatchScore(const domain::Match& match) {
-  if (!std::regex_match(std::string{match.TournamentId()}, ID_VALUE) ||
-    !std::regex_match(std::string{match.Id()}, ID_VALUE)) {
+  if (!domain::IsValidId(match.TournamentId()) ||
+    !domain::IsValidId(match.Id())) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
 
@@ -65,4 +128,57 @@ std::expected<std::string, Error> MatchDelegate::UpdateMatchScore(const domain::
   }
   
   return std::string{match.Id()};
+}
+
+std::vector<std::expected<std::string, Error>> MatchDelegate::UpdateMatchScores(const std::vector<domain::Match>& matches) {
+  std::vector<std::expected<std::string, Error>> results(matches.size(), std::unexpected(Error::NOT_FOUND));
+  std::vector<domain::Match> valid;
+  std::vector<std::size_t> positions;
+  for (std::size_t i = 0; i < matches.size(); ++i) {
+    const auto& match = matches[i];
+    const auto& score = match.MatchScore();
+    if (!domain::IsValidId(match.TournamentId()) || !domain::IsValidId(match.Id()) ||
+        score.homeTeamScore < 0 || score.visitorTeamScore < 0) {
+      results[i] = std::unexpected(Error::INVALID_FORMAT);
+      continue;
+    }
+    valid.push_back(match);
+    positions.push_back(i);
+  }
+  if (valid.empty()) {
+    return results;
+  }
+
+  // Matches missing from their tournament are simply not updated: existence is checked by the write itself.
+  std::vector<std::string> updated;
+  try {
+    updated = matchRepository->UpdateMatchScores(valid);
+  } catch (const std::exception& e) {
+    for (const auto position : positions) {
+      results[position] = std::unexpected(Error::UNKNOWN_ERROR);
+    }
+    return results;
+  }
+
+  // the ids come back as Postgres renders uuids (lowercase), whatever case the client sent
+  nlohmann::json events = nlohmann::json::array();
+  for (std::size_t i = 0; i < valid.size(); ++i) {
+    if (std::ranges::find(updated, domain::CanonicalId(valid[i].Id())) == updated.end()) {
+      continue;
+    }
+    results[positions[i]] = valid[i].Id();
+    const auto& score = valid[i].MatchScore();
+    events.push_back({{"tournamentId", valid[i].TournamentId()}, {"matchId", valid[i].Id()},
+                      {"homeTeamScore", score.homeTeamScore}, {"visitorTeamScore", score.visitorTeamScore}});
+  }
+
+  // One message carrying every applied score, in submission order
+  if (!events.empty()) {
+    try {
+      messageProducer->SendMessage(events.dump(), "tournament.score-update");
+    } catch (const std::exception& e) {
+      std::cout << "[MatchDelegate] ERROR sending message: " << e.what() << std::endl;
+    }
+  }
+  return results;
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include <expected>
 #include <iostream>
-#include <regex>
+#include <unordered_set>
 #include <utility>
 #include <pqxx/pqxx>
 
@@ -10,10 +10,10 @@
 #include "domain/Constants.hpp"
 
 TeamDelegate::TeamDelegate(
-    std::shared_ptr<IRepository<domain::Team, std::string_view>> repository)
+    std::shared_ptr<ITeamRepository> repository)
     : teamRepository(std::move(repository)) {}
 
-std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>
+std::expected<std::vector<domain::Team>, Error>
 TeamDelegate::GetAllTeams() {
   try {
     auto teams = teamRepository->ReadAll();
@@ -24,8 +24,16 @@ TeamDelegate::GetAllTeams() {
   }
 }
 
+std::expected<std::string, Error> TeamDelegate::GetAllTeamsJson() {
+  try {
+    return teamRepository->ReadAllAsJson();
+  } catch (const std::exception& e) {
+    return std::unexpected(Error::UNKNOWN_ERROR);
+  }
+}
+
 std::expected<std::shared_ptr<domain::Team>, Error> TeamDelegate::GetTeam(std::string_view id) {
-  if (!std::regex_match(std::string{id}, ID_VALUE)) {
+  if (!domain::IsValidId(id)) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
 
@@ -71,9 +79,50 @@ std::expected<std::string, Error> TeamDelegate::CreateTeam(
   }
 }
 
+std::expected<std::vector<std::expected<std::string, Error>>, Error> TeamDelegate::CreateTeams(
+    const std::vector<domain::Team>& teams) {
+  if (teams.empty()) {
+    return std::unexpected(Error::INVALID_FORMAT);
+  }
+  for (const auto& team : teams) {
+    if (!team.Id.empty() || team.Name.empty()) {
+      return std::unexpected(Error::INVALID_FORMAT);
+    }
+  }
+
+  // Names repeated inside the request are duplicates of their first occurrence; only distinct names reach
+  // the insert, which reports the ones already stored.
+  std::vector<std::expected<std::string, Error>> results(teams.size(), std::unexpected(Error::DUPLICATE));
+  std::vector<domain::Team> distinct;
+  std::vector<std::size_t> positions;
+  std::unordered_set<std::string_view> names;
+  for (std::size_t i = 0; i < teams.size(); ++i) {
+    if (names.insert(teams[i].Name).second) {
+      distinct.push_back(teams[i]);
+      positions.push_back(i);
+    }
+  }
+
+  try {
+    const auto ids = teamRepository->CreateMany(distinct);
+    if (ids.size() != distinct.size()) {
+      return std::unexpected(Error::UNKNOWN_ERROR);
+    }
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+      if (ids[i]) {
+        results[positions[i]] = *ids[i];
+      }
+    }
+    return results;
+
+  } catch (const std::exception& e) {
+    return std::unexpected(Error::UNKNOWN_ERROR);
+  }
+}
+
 std::expected<std::string, Error> TeamDelegate::UpdateTeam(
     const domain::Team& team) {
-  if (team.Id.empty() || !std::regex_match(team.Id, ID_VALUE)) {
+  if (team.Id.empty() || !domain::IsValidId(team.Id)) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
 
@@ -2,7 +2,6 @@
 
 #include <expected>
 #include <iostream>
-#include <regex>
 #include <utility>
 #include <pqxx/pqxx>
 
@@ -12,7 +11,7 @@ TournamentDelegate::TournamentDelegate(
     std::shared_ptr<IRepository<domain::Tournament, std::string>> repository)
     : tournamentRepository(std::move(repository)) {}
 
-std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>
+std::expected<std::vector<domain::Tournament>, Error>
 TournamentDelegate::ReadAll() {
 
   try {
@@ -25,7 +24,7 @@ TournamentDelegate::ReadAll() {
 }
 
 std::expected<std::shared_ptr<domain::Tournament>, Error> TournamentDelegate::GetTournament(std::string_view id) {
-  if (!std::regex_match(std::string(id), ID_VALUE)) {
+  if (!domain::IsValidId(id)) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
   try {
@@ -75,7 +74,7 @@ std::expected<std::string, Error> TournamentDelegate::CreateTournament(
 
 std::expected<std::string, Error> TournamentDelegate::UpdateTournament(
     const domain::Tournament& tournament) {
-    if (!std::regex_match(std::string(tournament.Id()), ID_VALUE)) {
+    if (!domain::IsValidId(tournament.Id())) {
       return std::unexpected(Error::INVALID_FORMAT);
     }
 
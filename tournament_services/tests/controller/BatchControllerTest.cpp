@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <crow.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/BatchController.hpp"
+
+namespace {
+    // Rutas falsas en la tabla de rutas enlazadas, en lugar de los controladores reales
+    std::atomic<int> created = 0;
+
+    void BindFakeRoutes() {
+        boundRoutes().clear();
+        boundRoutes().push_back({crow::HTTPMethod::Get, "/teams/<string>",
+            [](const crow::request& request, const std::vector<std::string>& parameters) {
+                if (parameters[0] == "missing") {
+                    return crow::response{crow::NOT_FOUND};
+                }
+                crow::response response{crow::OK, R"({"id":")" + parameters[0] + R"(","accept":")" + request.get_header_value("Accept") + "\"}"};
+                response.add_header("content-type", "application/json");
+                return response;
+            }});
+        boundRoutes().push_back({crow::HTTPMethod::Get, "/teams/static",
+            [](const crow::request&, const std::vector<std::string>&) {
+                return crow::response{crow::OK, "static"};
+            }});
+        boundRoutes().push_back({crow::HTTPMethod::Post, "/teams",
+            [](const crow::request& request, const std::vector<std::string>&) {
+                if (nlohmann::json::parse(request.body, nullptr, false).is_discarded()) {
+                    return crow::response{crow::BAD_REQUEST};
+                }
+                ++created;
+                crow::response response{crow::CREATED};
+                response.add_header("location", "t" + std::to_string(created.load()));
+                return response;
+            }});
+        boundRoutes().push_back({crow::HTTPMethod::Post, "/batch",
+            [](const crow::request&, const std::vector<std::string>&) {
+                ADD_FAILURE() << "nested batch dispatched";
+                return crow::response{crow::OK};
+            }});
+        boundRoutes().push_back({crow::HTTPMethod::Post, "/explode/<string>",
+            [](const crow::request&, const std::vector<std::string>&) -> crow::response {
+                throw 42;
+            }});
+        boundRoutes().push_back({crow::HTTPMethod::Get, "/search",
+            [](const crow::request& request, const std::vector<std::string>&) {
+                const char* name = request.url_params.get("name");
+                return crow::response{crow::OK, name ? name : ""};
+            }});
+    }
+
+    crow::request Batch(const std::string& body) {
+        crow::request request;
+        request.method = crow::HTTPMethod::Post;
+        request.url = "/batch";
+        request.body = body;
+        return request;
+    }
+}
+
+class BatchControllerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<concurrency::WorkerPool> workers = std::make_shared<concurrency::WorkerPool>(2);
+    std::shared_ptr<BatchController> controller = std::make_shared<BatchController>(workers);
+
+    void SetUp() override {
+        BindFakeRoutes();
+        created = 0;
+    }
+
+    void TearDown() override {
+        boundRoutes().clear();
+    }
+};
+
+// Validar que cada operacion devuelve su propio estado, en el orden del arreglo
+TEST_F(BatchControllerTest, Execute_ResultsInRequestOrder) {
+    crow::response response = controller->execute(Batch(R"([
+        {"method": "GET", "path": "/teams/a1", "headers": {"Accept": "application/x-msgpack"}},
+        {"method": "GET", "path": "/teams/missing"},
+        {"method": "POST", "path": "/teams", "body": {"name": "Lobos"}},
+        {"method": "GET", "path": "/teams/static"},
+        {"method": "GET", "path": "/search?name=Lobos"},
+        {"method": "DELETE", "path": "/teams/a1"}
+    ])"));
+
+    ASSERT_EQ(crow::OK, response.code);
+    const auto results = nlohmann::json::parse(response.body);
+    ASSERT_EQ(6, results.size());
+    EXPECT_EQ(200, results[0]["status"]);
+    // los cuerpos JSON se incrustan y las subpeticiones siempre piden JSON
+    EXPECT_EQ("a1", results[0]["body"]["id"]);
+    EXPECT_EQ("application/json", results[0]["body"]["accept"]);
+    EXPECT_EQ(404, results[1]["status"]);
+    EXPECT_FALSE(results[1].contains("body"));
+    EXPECT_EQ(201, results[2]["status"]);
+    EXPECT_EQ("t1", results[2]["headers"]["location"]);
+    EXPECT_EQ("static", results[3]["body"]);
+    EXPECT_EQ("Lobos", results[4]["body"]);
+    EXPECT_EQ(404, results[5]["status"]);
+}
+
+// Validar que una operacion no se ejecuta si falla aquella de la que depende
+TEST_F(BatchControllerTest, Execute_FailedDependencySkipsItem) {
+    crow::response response = controller->execute(Batch(R"([
+        {"method": "POST", "path": "/teams", "body": "no es json"},
+        {"method": "POST", "path": "/teams", "body": {"name": "Lobos"}, "dependsOn": [0]},
+        {"method": "POST", "path": "/teams", "body": {"name": "Osos"}}
+    ])"));
+
+    ASSERT_EQ(crow::OK, response.code);
+    const auto results = nlohmann::json::parse(response.body);
+    EXPECT_EQ(400, results[0]["status"]);
+    EXPECT_EQ(424, results[1]["status"]);
+    EXPECT_EQ(201, results[2]["status"]);
+    EXPECT_EQ(1, created.load());
+}
+
+// Validar que muchas operaciones independientes se ejecutan todas
+TEST_F(BatchControllerTest, Execute_ManyIndependentItems) {
+    nlohmann::json items = nlohmann::json::array();
+    for (int i = 0; i < 50; ++i) {
+        items.push_back({{"method", "POST"}, {"path", "/teams"}, {"body", {{"name", "equipo" + std::to_string(i)}}}});
+    }
+    crow::response response = controller->execute(Batch(items.dump()));
+
+    ASSERT_EQ(crow::OK, response.code);
+    const auto results = nlohmann::json::parse(response.body);
+    ASSERT_EQ(50, results.size());
+    for (const auto& result : results) {
+        EXPECT_EQ(201, result["status"]);
+    }
+    EXPECT_EQ(50, created.load());
+}
+
+// Validar que se rechazan los lotes mal formados indicando la operacion
+TEST_F(BatchControllerTest, Execute_InvalidBatch) {
+    EXPECT_EQ(crow::BAD_REQUEST, controller->execute(Batch(R"({"method": "GET"})")).code);
+    EXPECT_EQ(crow::BAD_REQUEST, controller->execute(Batch("[]")).code);
+
+    crow::response badMethod = controller->execute(Batch(R"([{"method": "GET", "path": "/teams/a"}, {"method": "TRACE", "path": "/teams"}])"));
+    EXPECT_EQ(crow::BAD_REQUEST, badMethod.code);
+    EXPECT_NE(std::string::npos, badMethod.body.find("[1].method"));
+
+    crow::response forward = controller->execute(Batch(R"([{"method": "GET", "path": "/teams/a", "dependsOn": [0]}])"));
+    EXPECT_EQ(crow::BAD_REQUEST, forward.code);
+    EXPECT_NE(std::string::npos, forward.body.find("[0].dependsOn"));
+
+    EXPECT_EQ(0, created.load());
+}
+
+// Validar que un lote anidado se rechaza por la ruta resuelta, tambien con barras de mas
+TEST_F(BatchControllerTest, Execute_NestedBatchRejected) {
+    crow::response response = controller->execute(Batch(R"([
+        {"method": "POST", "path": "/batch"},
+        {"method": "POST", "path": "/batch/"},
+        {"method": "POST", "path": "//batch?x=1"},
+        {"method": "GET", "path": "/teams/a"}
+    ])"));
+
+    ASSERT_EQ(crow::OK, response.code);
+    const auto results = nlohmann::json::parse(response.body);
+    ASSERT_EQ(4, results.size());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(crow::BAD_REQUEST, results[i]["status"]);
+        EXPECT_EQ("Batches cannot be nested", results[i]["body"]["message"]);
+    }
+    EXPECT_EQ(crow::OK, results[3]["status"]);
+}
+
+// Validar que una excepcion que no deriva de std::exception se responde como 500 sin cortar el lote
+TEST_F(BatchControllerTest, Execute_NonStandardExceptionIs500) {
+    crow::response response = controller->execute(Batch(R"([
+        {"method": "POST", "path": "/explode/a"},
+        {"method": "POST", "path": "/explode/b"},
+        {"method": "GET", "path": "/teams/c"}
+    ])"));
+
+    ASSERT_EQ(crow::OK, response.code);
+    const auto results = nlohmann::json::parse(response.body);
+    ASSERT_EQ(3, results.size());
+    EXPECT_EQ(crow::INTERNAL_SERVER_ERROR, results[0]["status"]);
+    EXPECT_EQ(crow::INTERNAL_SERVER_ERROR, results[1]["status"]);
+    EXPECT_EQ(crow::OK, results[2]["status"]);
+}
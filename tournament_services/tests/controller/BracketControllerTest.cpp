@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <crow.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+
+#include "controller/BracketController.hpp"
+#include "controller/ResponseBody.hpp"
+#include "delegate/IMatchDelegate.hpp"
+#include "events/ChangeVersions.hpp"
+#include "support/MatchDelegateMock.hpp"
+
+namespace {
+  const std::string TOURNAMENT_ID = "550e8400-e29b-41d4-a716-446655440000";
+
+  domain::Bracket SampleBracket() {
+    domain::Bracket bracket;
+    bracket.tournamentId = TOURNAMENT_ID;
+    domain::BracketMatch match;
+    match.id = "660e8400-e29b-41d4-a716-446655440001";
+    match.name = "W0";
+    match.home = {"team-a", "Team A", "Group A", 2};
+    match.visitor = {"team-b", "Team B", "Group B", 1};
+    bracket.winners.push_back({1, {match}});
+    return bracket;
+  }
+}
+
+class BracketControllerTest : public ::testing::Test {
+protected:
+  std::shared_ptr<test_support::MatchDelegateMock> matchDelegateMock = std::make_shared<test_support::MatchDelegateMock>();
+  std::shared_ptr<events::ChangeVersions> versions = std::make_shared<events::ChangeVersions>();
+  std::shared_ptr<BracketController> controller = std::make_shared<BracketController>(matchDelegateMock, versions);
+};
+
+// Validar el arbol con nombres y scores, servido desde cache hasta el siguiente cambio. Response 200
+TEST_F(BracketControllerTest, GetBracket_CachedUntilNextChange) {
+  versions->Connected();
+  EXPECT_CALL(*matchDelegateMock, GetBracket(std::string_view(TOURNAMENT_ID)))
+    .Times(2)
+    .WillRepeatedly(testing::Return(std::expected<domain::Bracket, Error>{SampleBracket()}));
+
+  crow::response first = controller->getBracket(crow::request{}, TOURNAMENT_ID);
+  EXPECT_EQ(crow::OK, first.code);
+  const auto body = nlohmann::json::parse(first.body);
+  EXPECT_EQ("Team A", body["winners"][0]["matches"][0]["home"]["teamName"]);
+  EXPECT_EQ("Group B", body["winners"][0]["matches"][0]["visitor"]["groupName"]);
+  EXPECT_EQ(1, body["winners"][0]["matches"][0]["visitor"]["score"]);
+
+  crow::response cached = controller->getBracket(crow::request{}, TOURNAMENT_ID);
+  EXPECT_EQ(first.body, cached.body);
+  EXPECT_EQ(first.get_header_value("etag"), cached.get_header_value("etag"));
+
+  versions->Changed(TOURNAMENT_ID);
+  crow::response changed = controller->getBracket(crow::request{}, TOURNAMENT_ID);
+  EXPECT_EQ(crow::OK, changed.code);
+  EXPECT_NE(first.get_header_value("etag"), changed.get_header_value("etag"));
+}
+
+// Validar que un id en mayusculas sigue la version del id en minusculas que reporta la base. Response 200
+TEST_F(BracketControllerTest, GetBracket_UppercaseIdFollowsChanges) {
+  versions->Connected();
+  EXPECT_CALL(*matchDelegateMock, GetBracket(std::string_view(TOURNAMENT_ID)))
+    .Times(2)
+    .WillRepeatedly(testing::Return(std::expected<domain::Bracket, Error>{SampleBracket()}));
+
+  const std::string upper = "550E8400-E29B-41D4-A716-446655440000";
+  crow::response first = controller->getBracket(crow::request{}, upper);
+  EXPECT_EQ(crow::OK, first.code);
+
+  versions->Changed(TOURNAMENT_ID);
+  crow::response changed = controller->getBracket(crow::request{}, upper);
+  EXPECT_EQ(crow::OK, changed.code);
+  EXPECT_NE(first.get_header_value("etag"), changed.get_header_value("etag"));
+}
+
+// Validar que un cliente con la version vigente recibe 304. Response 304
+TEST_F(BracketControllerTest, GetBracket_NotModified) {
+  versions->Connected();
+  EXPECT_CALL(*matchDelegateMock, GetBracket(testing::_))
+    .WillOnce(testing::Return(std::expected<domain::Bracket, Error>{SampleBracket()}));
+
+  crow::response first = controller->getBracket(crow::request{}, TOURNAMENT_ID);
+  crow::request revalidate;
+  revalidate.add_header("If-None-Match", first.get_header_value("etag"));
+
+  EXPECT_EQ(crow::NOT_MODIFIED, controller->getBracket(revalidate, TOURNAMENT_ID).code);
+}
+
+// Validar que la version vigente responde 304 sin armar el bracket aunque no este en cache. Response 304
+TEST_F(BracketControllerTest, GetBracket_NotModifiedWithoutCachedBody) {
+  versions->Connected();
+  EXPECT_CALL(*matchDelegateMock, GetBracket(testing::_)).Times(0);
+
+  crow::request revalidate;
+  revalidate.add_header("If-None-Match", EntityTag(*versions->Version(TOURNAMENT_ID), serialization::Encoding::JSON));
+
+  EXPECT_EQ(crow::NOT_MODIFIED, controller->getBracket(revalidate, TOURNAMENT_ID).code);
+}
+
+// Validar que sin la fuente de cambios conectada no se usa la cache. Response 200
+TEST_F(BracketControllerTest, GetBracket_NoCacheWhileFeedDown) {
+  EXPECT_CALL(*matchDelegateMock, GetBracket(testing::_))
+    .Times(2)
+    .WillRepeatedly(testing::Return(std::expected<domain::Bracket, Error>{SampleBracket()}));
+
+  EXPECT_EQ(crow::OK, controller->getBracket(crow::request{}, TOURNAMENT_ID).code);
+  crow::response second = controller->getBracket(crow::request{}, TOURNAMENT_ID);
+  EXPECT_EQ(crow::OK, second.code);
+  EXPECT_TRUE(second.get_header_value("etag").empty());
+}
+
+// Validar torneo inexistente. Response 404
+TEST_F(BracketControllerTest, GetBracket_TournamentNotFound) {
+  versions->Connected();
+  EXPECT_CALL(*matchDelegateMock, GetBracket(testing::_))
+    .WillOnce(testing::Return(std::expected<domain::Bracket, Error>{std::unexpected(Error::NOT_FOUND)}));
+
+  EXPECT_EQ(crow::NOT_FOUND, controller->getBracket(crow::request{}, TOURNAMENT_ID).code);
+}
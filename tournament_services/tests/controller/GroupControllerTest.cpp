@@ -17,7 +17,8 @@ class GroupDelegateMock : public IGroupDelegate {
     public:
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Group>, Error>), GetGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD((std::expected<std::string, Error>), CreateGroup, (const std::string_view& tournamentId, const domain::Group& group), (override));
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Group>>, Error>), GetGroups, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD((std::expected<std::vector<domain::Group>, Error>), GetGroups, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), GetGroupsJson, (const std::string_view& tournamentId), (override));
     MOCK_METHOD((std::expected<void, Error>), UpdateGroup, (const std::string_view& tournamentId, const domain::Group& group, const std::string_view& groupId), (override)); 
     MOCK_METHOD((std::expected<void, Error>), RemoveGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD((std::expected<void, Error>), UpdateTeams, (const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& teams), (override));
@@ -115,7 +116,7 @@ TEST_F(GroupControllerTest, GetGroup_Ok) {
         testing::Eq(groupId)
     )).WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Group>, Error>{expectedGroup}));
     
-    crow::response response = groupController->GetGroup(tournamentId, groupId);
+    crow::response response = groupController->GetGroup(crow::request{}, tournamentId, groupId);
     
     EXPECT_EQ(crow::OK, response.code);
     EXPECT_EQ("application/json", response.get_header_value("content-type"));
@@ -139,7 +140,7 @@ TEST_F(GroupControllerTest, GetGroup_NotFound) {
         testing::Eq(groupId)
     )).WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Group>, Error>{std::unexpected(Error::NOT_FOUND)}));
     
-    crow::response response = groupController->GetGroup(tournamentId, groupId);
+    crow::response response = groupController->GetGroup(crow::request{}, tournamentId, groupId);
     
     EXPECT_EQ(crow::NOT_FOUND, response.code);
     EXPECT_EQ("Error", response.body);
@@ -242,6 +243,29 @@ TEST_F(GroupControllerTest, AddTeams_NoContent) {
     EXPECT_EQ(crow::NO_CONTENT, response.code);
 }
 
+// Validar que un equipo sin id se rechaza antes de llegar a GroupDelegate. Response 400
+TEST_F(GroupControllerTest, AddTeams_MissingTeamId) {
+    std::string tournamentId = "12345678-1234-1234-1234-123456789abc";
+    std::string groupId = "87654321-4321-4321-4321-123456789012";
+
+    nlohmann::json requestJson = nlohmann::json::array({
+        {{"id", "team-id-1"}, {"name", "Team One"}},
+        {{"name", "Team Two"}}
+    });
+
+    EXPECT_CALL(*groupDelegateMock, UpdateTeams(testing::_, testing::_, testing::_)).Times(0);
+
+    crow::request request;
+    request.body = requestJson.dump();
+
+    crow::response response = groupController->AddTeams(request, tournamentId, groupId);
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    auto body = nlohmann::json::parse(response.body);
+    EXPECT_EQ("[1].id", body["field"]);
+    EXPECT_EQ("id is required and must be a string", body["message"]);
+}
+
 // Validar transformacion de JSON al objeto de dominio Team y validar que el valor que se le transfiera a GroupDelegate es el esperado. Simular que el equipo no exista y el resultado sea HTTP 422
 TEST_F(GroupControllerTest, AddTeams_UnprocessableEntity) {
     std::string tournamentId = "12345678-1234-1234-1234-123456789abc";
@@ -5,27 +5,27 @@
 #include <expected>
 
 #include "domain/Match.hpp"
+#include "domain/Utilities.hpp"
 #include "delegate/IMatchDelegate.hpp"
 #include "controller/MatchController.hpp"
+#include "controller/ResponseBody.hpp"
 #include "exception/Error.hpp"
+#include "support/MatchDelegateMock.hpp"
 
-class MatchDelegateMock : public IMatchDelegate {
-public:
-  MOCK_METHOD((std::expected<std::shared_ptr<domain::Match>, Error>), GetMatch, (std::string_view tournamentId, std::string_view matchId), (override));
-  MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>), GetMatches,
-              (std::string_view tournamentId), (override));
-  MOCK_METHOD((std::expected<std::string, Error>), UpdateMatchScore,
-              (const domain::Match&), (override));
-};
+using test_support::MatchDelegateMock;
+
+const auto ALL_FIELDS = serialization::FieldSet<domain::Match>::All();
 
 class MatchControllerTest : public ::testing::Test {
 protected:
   std::shared_ptr<MatchDelegateMock> matchDelegateMock;
+  std::shared_ptr<concurrency::ScoreSubmissionQueue> scoreQueue;
   std::shared_ptr<MatchController> matchController;
 
   void SetUp() override {
     matchDelegateMock = std::make_shared<MatchDelegateMock>();
-    matchController = std::make_shared<MatchController>(matchDelegateMock);
+    scoreQueue = std::make_shared<concurrency::ScoreSubmissionQueue>(matchDelegateMock, 16, 8);
+    matchController = std::make_shared<MatchController>(matchDelegateMock, scoreQueue);
   }
 };
 
@@ -51,7 +51,7 @@ TEST_F(MatchControllerTest, GetMatch_Ok) {
     .WillOnce(testing::Return(
         std::expected<std::shared_ptr<domain::Match>, Error>{std::in_place, expectedMatch}));
 
-  crow::response response = matchController->getMatch(tournamentId, matchId);
+  crow::response response = matchController->getMatch(crow::request{}, tournamentId, matchId);
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
@@ -77,7 +77,7 @@ TEST_F(MatchControllerTest, GetMatch_NotFound) {
     .WillOnce(testing::Return(
         std::expected<std::shared_ptr<domain::Match>, Error>{std::unexpected(Error::NOT_FOUND)}));
 
-  crow::response response = matchController->getMatch(tournamentId, matchId);
+  crow::response response = matchController->getMatch(crow::request{}, tournamentId, matchId);
 
   EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
@@ -93,7 +93,7 @@ TEST_F(MatchControllerTest, GetMatch_TournamentNotFound) {
     .WillOnce(testing::Return(
         std::expected<std::shared_ptr<domain::Match>, Error>{std::unexpected(Error::NOT_FOUND)}));
 
-  crow::response response = matchController->getMatch(tournamentId, matchId);
+  crow::response response = matchController->getMatch(crow::request{}, tournamentId, matchId);
 
   EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
@@ -103,61 +103,67 @@ TEST_F(MatchControllerTest, GetMatch_TournamentNotFound) {
 // Validar respuesta exitosa con lista de matches. Response 200
 TEST_F(MatchControllerTest, GetMatches_Ok) {
   std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
-  std::vector<std::shared_ptr<domain::Match>> matches;
+  std::vector<domain::Match> matches;
   
-  auto match1 = std::make_shared<domain::Match>();
-  match1->Id() = "match-id-001";
-  match1->TournamentId() = tournamentId;
-  match1->Name() = "W0";
-  match1->HomeTeamId() = "team-home-1";
-  match1->VisitorTeamId() = "team-visitor-1";
-  match1->MatchScore().homeTeamScore = 3;
-  match1->MatchScore().visitorTeamScore = 1;
+  domain::Match match1;
+  match1.Id() = "match-id-001";
+  match1.TournamentId() = tournamentId;
+  match1.Name() = "W0";
+  match1.HomeTeamId() = "team-home-1";
+  match1.VisitorTeamId() = "team-visitor-1";
+  match1.MatchScore().homeTeamScore = 3;
+  match1.MatchScore().visitorTeamScore = 1;
   
-  auto match2 = std::make_shared<domain::Match>();
-  match2->Id() = "match-id-002";
-  match2->TournamentId() = tournamentId;
-  match2->Name() = "W1";
-  match2->HomeTeamId() = "team-home-2";
-  match2->VisitorTeamId() = "team-visitor-2";
-  match2->MatchScore().homeTeamScore = 2;
-  match2->MatchScore().visitorTeamScore = 2;
+  domain::Match match2;
+  match2.Id() = "match-id-002";
+  match2.TournamentId() = tournamentId;
+  match2.Name() = "W1";
+  match2.HomeTeamId() = "team-home-2";
+  match2.VisitorTeamId() = "team-visitor-2";
+  match2.MatchScore().homeTeamScore = 2;
+  match2.MatchScore().visitorTeamScore = 2;
   
   matches.push_back(match1);
   matches.push_back(match2);
 
-  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
-    .WillOnce(testing::Return(
-        std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>{std::in_place, matches}));
+  // el cuerpo viene renderizado desde la base de datos y se envia sin tocar
+  nlohmann::json rendered = matches;
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "2-20251018120000000000"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(std::string_view(tournamentId), ALL_FIELDS))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, rendered.dump(1)}));
 
-  crow::response response = matchController->getMatches(tournamentId);
+  crow::response response = matchController->getMatches(crow::request{}, tournamentId);
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
+  EXPECT_EQ(rendered.dump(1), response.body);
+  EXPECT_EQ("application/json", response.get_header_value("content-type"));
   ASSERT_EQ(jsonResponse.size(), matches.size());
   
-  EXPECT_EQ(jsonResponse[0]["id"].get<std::string>(), matches[0]->Id());
-  EXPECT_EQ(jsonResponse[0]["tournamentId"].get<std::string>(), matches[0]->TournamentId());
-  EXPECT_EQ(jsonResponse[0]["name"].get<std::string>(), matches[0]->Name());
-  EXPECT_EQ(jsonResponse[0]["homeTeamId"].get<std::string>(), matches[0]->HomeTeamId());
-  EXPECT_EQ(jsonResponse[0]["visitorTeamId"].get<std::string>(), matches[0]->VisitorTeamId());
+  EXPECT_EQ(jsonResponse[0]["id"].get<std::string>(), matches[0].Id());
+  EXPECT_EQ(jsonResponse[0]["tournamentId"].get<std::string>(), matches[0].TournamentId());
+  EXPECT_EQ(jsonResponse[0]["name"].get<std::string>(), matches[0].Name());
+  EXPECT_EQ(jsonResponse[0]["homeTeamId"].get<std::string>(), matches[0].HomeTeamId());
+  EXPECT_EQ(jsonResponse[0]["visitorTeamId"].get<std::string>(), matches[0].VisitorTeamId());
   EXPECT_EQ(jsonResponse[0]["score"]["homeTeamScore"].get<int>(), 3);
   EXPECT_EQ(jsonResponse[0]["score"]["visitorTeamScore"].get<int>(), 1);
   
-  EXPECT_EQ(jsonResponse[1]["id"].get<std::string>(), matches[1]->Id());
-  EXPECT_EQ(jsonResponse[1]["name"].get<std::string>(), matches[1]->Name());
+  EXPECT_EQ(jsonResponse[1]["id"].get<std::string>(), matches[1].Id());
+  EXPECT_EQ(jsonResponse[1]["name"].get<std::string>(), matches[1].Name());
 }
 
 // Validar respuesta exitosa con lista vacia de matches. Response 200
 TEST_F(MatchControllerTest, GetMatches_Empty) {
   std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
-  std::vector<std::shared_ptr<domain::Match>> emptyMatches;
+  std::vector<domain::Match> emptyMatches;
 
-  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
-    .WillOnce(testing::Return(
-        std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>{std::in_place, emptyMatches}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "0-0"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(std::string_view(tournamentId), ALL_FIELDS))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "[]"}));
 
-  crow::response response = matchController->getMatches(tournamentId);
+  crow::response response = matchController->getMatches(crow::request{}, tournamentId);
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
@@ -168,15 +174,209 @@ TEST_F(MatchControllerTest, GetMatches_Empty) {
 TEST_F(MatchControllerTest, GetMatches_TournamentNotFound) {
   std::string tournamentId = "non-existent-tournament-id";
 
-  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
-    .WillOnce(testing::Return(
-        std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>{std::unexpected(Error::NOT_FOUND)}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::unexpected(Error::NOT_FOUND)}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(testing::_, testing::_)).Times(0);
 
-  crow::response response = matchController->getMatches(tournamentId);
+  crow::response response = matchController->getMatches(crow::request{}, tournamentId);
 
   EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
 
+// Validar que la lista se codifica en MessagePack cuando el cliente lo pide en Accept. Response 200
+TEST_F(MatchControllerTest, GetMatches_MsgPack) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  domain::Match match;
+  match.Id() = "match-id-001";
+  match.TournamentId() = tournamentId;
+  match.MatchScore().homeTeamScore = 3;
+  std::pmr::vector<domain::Match> matches = {match};
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "1-20251018120000000000"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId), ALL_FIELDS))
+    .WillOnce(testing::Return(
+        std::expected<std::pmr::vector<domain::Match>, Error>{std::in_place, matches}));
+
+  crow::request request;
+  request.add_header("Accept", "application/msgpack, application/json;q=0.5");
+  crow::response response = matchController->getMatches(request, tournamentId);
+
+  EXPECT_EQ(crow::OK, response.code);
+  EXPECT_EQ("application/msgpack", response.get_header_value("content-type"));
+  auto decoded = nlohmann::json::from_msgpack(response.body);
+  ASSERT_EQ(1, decoded.size());
+  EXPECT_EQ("match-id-001", decoded[0]["id"]);
+  EXPECT_EQ(3, decoded[0]["score"]["homeTeamScore"]);
+}
+
+// Validar que la respuesta lleva un ETag fuerte y que un If-None-Match igual devuelve 304 sin leer los matches
+TEST_F(MatchControllerTest, GetMatches_NotModified) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .Times(2)
+    .WillRepeatedly(testing::Return(std::expected<std::string, Error>{std::in_place, "3-20251018120000000000"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(std::string_view(tournamentId), ALL_FIELDS))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "[]"}));
+
+  crow::response first = matchController->getMatches(crow::request{}, tournamentId);
+  std::string etag = first.get_header_value("etag");
+  ASSERT_FALSE(etag.empty());
+  EXPECT_EQ('"', etag.front());
+
+  crow::request poll;
+  poll.add_header("If-None-Match", "\"otro\", " + etag);
+  crow::response response = matchController->getMatches(poll, tournamentId);
+
+  EXPECT_EQ(crow::NOT_MODIFIED, response.code);
+  EXPECT_TRUE(response.body.empty());
+  EXPECT_EQ(etag, response.get_header_value("etag"));
+}
+
+// Validar que un If-None-Match vigente devuelve 304 aunque esta instancia no tenga el cuerpo en cache
+TEST_F(MatchControllerTest, GetMatches_NotModifiedWithoutCachedBody) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "3-20251018120000000000"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(testing::_, testing::_)).Times(0);
+  EXPECT_CALL(*matchDelegateMock, GetMatches(testing::_, testing::_)).Times(0);
+
+  crow::request poll;
+  poll.add_header("If-None-Match", EntityTag("3-20251018120000000000", serialization::Encoding::JSON));
+  crow::response response = matchController->getMatches(poll, tournamentId);
+
+  EXPECT_EQ(crow::NOT_MODIFIED, response.code);
+  EXPECT_TRUE(response.body.empty());
+}
+
+// Validar que el cuerpo se sirve desde la cache mientras la version no cambia y se renderiza de nuevo cuando cambia
+TEST_F(MatchControllerTest, GetMatches_CachedUntilVersionChanges) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "1-1"}))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "1-1"}))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "1-2"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(std::string_view(tournamentId), ALL_FIELDS))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, R"([{"id": "m1"}])"}))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, R"([{"id": "m2"}])"}));
+
+  crow::response first = matchController->getMatches(crow::request{}, tournamentId);
+  crow::response cached = matchController->getMatches(crow::request{}, tournamentId);
+  crow::response updated = matchController->getMatches(crow::request{}, tournamentId);
+
+  EXPECT_EQ(crow::OK, cached.code);
+  EXPECT_EQ(first.body, cached.body);
+  EXPECT_EQ(first.get_header_value("etag"), cached.get_header_value("etag"));
+  EXPECT_EQ("application/json", cached.get_header_value("content-type"));
+  EXPECT_EQ(R"([{"id": "m2"}])", updated.body);
+  EXPECT_NE(first.get_header_value("etag"), updated.get_header_value("etag"));
+}
+
+// Validar que el cuerpo se comprime una sola vez, se sirve comprimido desde la cache y revalida con el ETag gzip
+TEST_F(MatchControllerTest, GetMatches_GzipCached) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  std::vector<domain::Match> matches(63);
+  for (std::size_t i = 0; i < matches.size(); ++i) {
+    matches[i].Id() = "match-id-" + std::to_string(i);
+    matches[i].TournamentId() = tournamentId;
+  }
+  nlohmann::json rendered = matches;
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .Times(3)
+    .WillRepeatedly(testing::Return(std::expected<std::string, Error>{std::in_place, "63-1"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(std::string_view(tournamentId), ALL_FIELDS))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, rendered.dump()}));
+
+  crow::request request;
+  request.add_header("Accept-Encoding", "gzip, deflate");
+  crow::response first = matchController->getMatches(request, tournamentId);
+  crow::response cached = matchController->getMatches(request, tournamentId);
+
+  EXPECT_EQ("gzip", first.get_header_value("content-encoding"));
+  EXPECT_LT(first.body.size(), rendered.dump().size());
+  EXPECT_EQ(first.body, cached.body);
+  EXPECT_EQ("gzip", cached.get_header_value("content-encoding"));
+  EXPECT_EQ(first.get_header_value("etag"), cached.get_header_value("etag"));
+  EXPECT_NE(std::string::npos, cached.get_header_value("vary").find("Accept-Encoding"));
+
+  crow::request poll;
+  poll.add_header("Accept-Encoding", "gzip, deflate");
+  poll.add_header("If-None-Match", first.get_header_value("etag"));
+  crow::response response = matchController->getMatches(poll, tournamentId);
+
+  EXPECT_EQ(crow::NOT_MODIFIED, response.code);
+  EXPECT_EQ(first.get_header_value("etag"), response.get_header_value("etag"));
+}
+
+// Validar que ?fields= llega al delegate como proyeccion y que la lista parcial tiene su propio ETag. Response 200
+TEST_F(MatchControllerTest, GetMatches_SparseFieldset) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  const auto projected = serialization::FieldSet<domain::Match>::Parse("id, score");
+  ASSERT_TRUE(projected.has_value());
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .Times(2)
+    .WillRepeatedly(testing::Return(std::expected<std::string, Error>{std::in_place, "1-1"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(std::string_view(tournamentId), ALL_FIELDS))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, R"([{"id": "m1", "name": "W0"}])"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatchesJson(std::string_view(tournamentId), *projected))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, R"([{"id": "m1"}])"}));
+
+  crow::request request;
+  request.url_params = crow::query_string("/tournaments/x/matches?fields=id,score");
+  crow::response full = matchController->getMatches(crow::request{}, tournamentId);
+  crow::response sparse = matchController->getMatches(request, tournamentId);
+
+  EXPECT_EQ(crow::OK, sparse.code);
+  EXPECT_EQ(R"([{"id": "m1"}])", sparse.body);
+  EXPECT_NE(full.get_header_value("etag"), sparse.get_header_value("etag"));
+}
+
+// Validar que los matches proyectados se codifican solo con los campos pedidos en MessagePack. Response 200
+TEST_F(MatchControllerTest, GetMatches_SparseFieldsetMsgPack) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  domain::Match match;
+  match.Id() = "match-id-001";
+  match.MatchScore().homeTeamScore = 3;
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "1-1"}));
+  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId), testing::Ne(ALL_FIELDS)))
+    .WillOnce(testing::Return(std::expected<std::pmr::vector<domain::Match>, Error>{std::in_place, std::pmr::vector<domain::Match>{match}}));
+
+  crow::request request;
+  request.url_params = crow::query_string("/tournaments/x/matches?fields=id,score");
+  request.add_header("Accept", "application/msgpack");
+  crow::response response = matchController->getMatches(request, tournamentId);
+
+  EXPECT_EQ(crow::OK, response.code);
+  auto decoded = nlohmann::json::from_msgpack(response.body);
+  ASSERT_EQ(1, decoded.size());
+  EXPECT_EQ(2, decoded[0].size());
+  EXPECT_EQ("match-id-001", decoded[0]["id"]);
+  EXPECT_EQ(3, decoded[0]["score"]["homeTeamScore"]);
+}
+
+// Validar que un campo desconocido en ?fields= se rechaza sin leer nada. Response 400
+TEST_F(MatchControllerTest, GetMatches_UnknownField) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+  EXPECT_CALL(*matchDelegateMock, GetMatchesVersion(testing::_)).Times(0);
+
+  crow::request request;
+  request.url_params = crow::query_string("/tournaments/x/matches?fields=id,password");
+  crow::response response = matchController->getMatches(request, tournamentId);
+
+  EXPECT_EQ(crow::BAD_REQUEST, response.code);
+  auto body = nlohmann::json::parse(response.body);
+  EXPECT_EQ("fields", body["field"]);
+  EXPECT_EQ("Unknown field password", body["message"]);
+}
+
 // Tests de UpdateMatchScore
 
 // Validar actualizacion exitosa del score. Response 200
@@ -209,6 +409,31 @@ TEST_F(MatchControllerTest, UpdateMatchScore_Ok) {
   EXPECT_EQ(2, capturedMatch.MatchScore().visitorTeamScore);
 }
 
+// Validar que un cuerpo CBOR pasa por el mismo esquema que JSON. Response 200
+TEST_F(MatchControllerTest, UpdateMatchScore_CborBody) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  std::string matchId = "match-id-001";
+  domain::Match capturedMatch;
+
+  EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(testing::_))
+    .WillOnce(testing::DoAll(
+        testing::SaveArg<0>(&capturedMatch),
+        testing::Return(std::expected<std::string, Error>{std::in_place, matchId})));
+
+  nlohmann::json requestBody = {{"score", {{"homeTeamScore", 4}, {"visitorTeamScore", 1}}}};
+  const auto cbor = nlohmann::json::to_cbor(requestBody);
+
+  crow::request request;
+  request.add_header("Content-Type", "application/cbor");
+  request.body.assign(cbor.begin(), cbor.end());
+
+  crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
+
+  EXPECT_EQ(crow::OK, response.code);
+  EXPECT_EQ(4, capturedMatch.MatchScore().homeTeamScore);
+  EXPECT_EQ(1, capturedMatch.MatchScore().visitorTeamScore);
+}
+
 // Validar actualizacion con scores en cero. Response 200
 TEST_F(MatchControllerTest, UpdateMatchScore_ZeroScores) {
   std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
@@ -248,7 +473,7 @@ TEST_F(MatchControllerTest, UpdateMatchScore_InvalidJson) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("Invalid JSON format", response.body);
+  EXPECT_EQ("Invalid JSON format", nlohmann::json::parse(response.body)["message"]);
 }
 
 // Validar error cuando falta el objeto score. Response 400
@@ -267,7 +492,7 @@ TEST_F(MatchControllerTest, UpdateMatchScore_MissingMatchScore) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("Missing or invalid score object", response.body);
+  EXPECT_EQ("Missing or invalid score object", nlohmann::json::parse(response.body)["message"]);
 }
 
 // Validar error cuando score no es un objeto. Response 400
@@ -285,7 +510,7 @@ TEST_F(MatchControllerTest, UpdateMatchScore_MatchScoreNotObject) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("Missing or invalid score object", response.body);
+  EXPECT_EQ("Missing or invalid score object", nlohmann::json::parse(response.body)["message"]);
 }
 
 // Validar error cuando faltan campos de scores. Response 400
@@ -306,7 +531,8 @@ TEST_F(MatchControllerTest, UpdateMatchScore_MissingScoreFields) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("score must contain integer homeTeamScore and visitorTeamScore", response.body);
+  EXPECT_EQ("score must contain integer homeTeamScore and visitorTeamScore", nlohmann::json::parse(response.body)["message"]);
+  EXPECT_EQ("score.visitorTeamScore", nlohmann::json::parse(response.body)["field"]);
 }
 
 // Validar error cuando los scores no son enteros. Response 400
@@ -327,7 +553,7 @@ TEST_F(MatchControllerTest, UpdateMatchScore_ScoresNotInteger) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("score must contain integer homeTeamScore and visitorTeamScore", response.body);
+  EXPECT_EQ("score must contain integer homeTeamScore and visitorTeamScore", nlohmann::json::parse(response.body)["message"]);
 }
 
 // Validar error cuando los scores son negativos. Response 400
@@ -348,7 +574,7 @@ TEST_F(MatchControllerTest, UpdateMatchScore_NegativeScores) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("Scores must be non-negative", response.body);
+  EXPECT_EQ("Scores must be non-negative", nlohmann::json::parse(response.body)["message"]);
 }
 
 // Validar error cuando el tournamentId del body no coincide con el path. Response 400
@@ -370,7 +596,7 @@ TEST_F(MatchControllerTest, UpdateMatchScore_TournamentIdMismatch) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("Tournament ID in body does not match path", response.body);
+  EXPECT_EQ("Tournament ID in body does not match path", nlohmann::json::parse(response.body)["message"]);
 }
 
 // Validar error cuando el matchId del body no coincide con el path. Response 400
@@ -392,7 +618,7 @@ TEST_F(MatchControllerTest, UpdateMatchScore_MatchIdMismatch) {
   crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
-  EXPECT_EQ("Match ID in body does not match path", response.body);
+  EXPECT_EQ("Match ID in body does not match path", nlohmann::json::parse(response.body)["message"]);
 }
 
 // Validar error NOT_FOUND cuando el match no existe. Response 404
@@ -442,3 +668,42 @@ TEST_F(MatchControllerTest, UpdateMatchScore_InvalidFormat) {
 
   EXPECT_EQ(crow::BAD_REQUEST, response.code);
 }
+
+// Tests de UpdateMatchScore asincrono
+
+// Validar que con Prefer: respond-async el score se encola y se responde sin esperar la escritura. Response 202
+TEST_F(MatchControllerTest, UpdateMatchScore_AsyncAccepted) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  std::string matchId = "660e8400-e29b-41d4-a716-446655440001";
+
+  EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(testing::_)).Times(0);
+  EXPECT_CALL(*matchDelegateMock, UpdateMatchScores(testing::SizeIs(1)))
+    .WillOnce(testing::Return(std::vector<std::expected<std::string, Error>>{matchId}));
+
+  crow::request request;
+  request.add_header("Prefer", "respond-async");
+  request.body = R"({"score": {"homeTeamScore": 1, "visitorTeamScore": 0}})";
+
+  crow::response response = matchController->updateMatchScore(request, tournamentId, matchId);
+
+  EXPECT_EQ(crow::ACCEPTED, response.code);
+  auto jsonResponse = nlohmann::json::parse(response.body);
+  EXPECT_EQ("pending", jsonResponse["status"]);
+  EXPECT_EQ("/operations/" + jsonResponse["operationId"].get<std::string>(), response.get_header_value("Location"));
+}
+
+// Validar que con la cola llena se pide al cliente reintentar. Response 503
+TEST_F(MatchControllerTest, UpdateMatchScore_AsyncQueueFull) {
+  auto fullQueue = std::make_shared<concurrency::ScoreSubmissionQueue>(matchDelegateMock, 0, 8);
+  MatchController controller(matchDelegateMock, fullQueue);
+
+  crow::request request;
+  request.add_header("Prefer", "respond-async");
+  request.body = R"({"score": {"homeTeamScore": 1, "visitorTeamScore": 0}})";
+
+  crow::response response = controller.updateMatchScore(request, "550e8400-e29b-41d4-a716-446655440000",
+                                                        "660e8400-e29b-41d4-a716-446655440001");
+
+  EXPECT_EQ(crow::SERVICE_UNAVAILABLE, response.code);
+  EXPECT_EQ("1", response.get_header_value("Retry-After"));
+}
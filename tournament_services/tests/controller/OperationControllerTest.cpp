@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <crow.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+
+#include "concurrency/ScoreSubmissionQueue.hpp"
+#include "controller/OperationController.hpp"
+#include "delegate/IMatchDelegate.hpp"
+#include "support/MatchDelegateMock.hpp"
+
+namespace {
+  const std::string TOURNAMENT_ID = "550e8400-e29b-41d4-a716-446655440000";
+
+  domain::Match ScoredMatch(const std::string& matchId) {
+    domain::Match match;
+    match.Id() = matchId;
+    match.TournamentId() = TOURNAMENT_ID;
+    match.MatchScore().homeTeamScore = 2;
+    match.MatchScore().visitorTeamScore = 1;
+    return match;
+  }
+}
+
+class OperationControllerTest : public ::testing::Test {
+protected:
+  std::shared_ptr<test_support::MatchDelegateMock> matchDelegateMock = std::make_shared<test_support::MatchDelegateMock>();
+  std::shared_ptr<concurrency::ScoreSubmissionQueue> scoreQueue =
+      std::make_shared<concurrency::ScoreSubmissionQueue>(matchDelegateMock, 16, 8);
+  std::shared_ptr<OperationController> controller = std::make_shared<OperationController>(scoreQueue);
+
+  // El trabajador procesa en segundo plano: esperar a que la operacion deje de estar pendiente
+  nlohmann::json AwaitFinished(const std::string& operationId) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    nlohmann::json body;
+    do {
+      body = nlohmann::json::parse(controller->getOperation(operationId).body);
+      if (body["status"] != "pending") {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    } while (std::chrono::steady_clock::now() < deadline);
+    return body;
+  }
+};
+
+// Validar que una operacion escrita termina como exitosa. Response 200
+TEST_F(OperationControllerTest, GetOperation_Succeeded) {
+  const std::string matchId = "660e8400-e29b-41d4-a716-446655440001";
+  EXPECT_CALL(*matchDelegateMock, UpdateMatchScores(testing::SizeIs(1)))
+    .WillOnce(testing::Return(std::vector<std::expected<std::string, Error>>{matchId}));
+
+  const auto operationId = scoreQueue->Submit(ScoredMatch(matchId));
+  ASSERT_TRUE(operationId.has_value());
+
+  const auto body = AwaitFinished(*operationId);
+  EXPECT_EQ("succeeded", body["status"]);
+  EXPECT_EQ(matchId, body["matchId"]);
+  EXPECT_FALSE(body.contains("error"));
+}
+
+// Validar que un partido inexistente deja la operacion fallida con el estado que habria dado el PATCH. Response 200
+TEST_F(OperationControllerTest, GetOperation_Failed) {
+  EXPECT_CALL(*matchDelegateMock, UpdateMatchScores(testing::_))
+    .WillOnce(testing::Return(std::vector<std::expected<std::string, Error>>{std::unexpected(Error::NOT_FOUND)}));
+
+  const auto operationId = scoreQueue->Submit(ScoredMatch("660e8400-e29b-41d4-a716-446655440002"));
+  ASSERT_TRUE(operationId.has_value());
+
+  const auto body = AwaitFinished(*operationId);
+  EXPECT_EQ("failed", body["status"]);
+  EXPECT_EQ(crow::NOT_FOUND, body["error"]["status"]);
+}
+
+// Validar que dos scores del mismo partido se escriben en lotes distintos y en orden de llegada
+TEST_F(OperationControllerTest, Submit_SameMatchKeepsOrder) {
+  const std::string matchId = "660e8400-e29b-41d4-a716-446655440003";
+  std::vector<int> writtenScores;
+  EXPECT_CALL(*matchDelegateMock, UpdateMatchScores(testing::SizeIs(1)))
+    .Times(2)
+    .WillRepeatedly([&](const std::vector<domain::Match>& matches) {
+      writtenScores.push_back(matches.front().MatchScore().homeTeamScore);
+      return std::vector<std::expected<std::string, Error>>{matches.front().Id()};
+    });
+
+  auto first = ScoredMatch(matchId);
+  auto second = ScoredMatch(matchId);
+  second.MatchScore().homeTeamScore = 3;
+  scoreQueue->Submit(first);
+  const auto last = scoreQueue->Submit(second);
+  ASSERT_TRUE(last.has_value());
+
+  EXPECT_EQ("succeeded", AwaitFinished(*last)["status"]);
+  EXPECT_EQ((std::vector<int>{2, 3}), writtenScores);
+}
+
+// Validar operacion desconocida e id invalido. Response 404 y 400
+TEST_F(OperationControllerTest, GetOperation_UnknownOrInvalid) {
+  EXPECT_EQ(crow::NOT_FOUND, controller->getOperation("770e8400-e29b-41d4-a716-446655440000").code);
+  EXPECT_EQ(crow::BAD_REQUEST, controller->getOperation("not-an-id").code);
+}
+
+// Validar que al cerrar la cola se escriben los scores pendientes y no se aceptan nuevos
+TEST_F(OperationControllerTest, Close_FlushesPendingSubmissions) {
+  EXPECT_CALL(*matchDelegateMock, UpdateMatchScores(testing::_))
+    .WillRepeatedly([](const std::vector<domain::Match>& matches) {
+      std::vector<std::expected<std::string, Error>> results;
+      for (const auto& match : matches) {
+        results.emplace_back(match.Id());
+      }
+      return results;
+    });
+
+  const auto first = scoreQueue->Submit(ScoredMatch("660e8400-e29b-41d4-a716-446655440004"));
+  const auto second = scoreQueue->Submit(ScoredMatch("660e8400-e29b-41d4-a716-446655440005"));
+  ASSERT_TRUE(first.has_value() && second.has_value());
+
+  scoreQueue->Close();
+
+  EXPECT_EQ(concurrency::OperationStatus::SUCCEEDED, scoreQueue->Find(*first)->status);
+  EXPECT_EQ(concurrency::OperationStatus::SUCCEEDED, scoreQueue->Find(*second)->status);
+  EXPECT_EQ(0u, scoreQueue->Pending());
+  EXPECT_FALSE(scoreQueue->Submit(ScoredMatch("660e8400-e29b-41d4-a716-446655440006")).has_value());
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "controller/SingleFlight.hpp"
+
+// Validar que las llamadas concurrentes con la misma clave comparten un solo resultado
+TEST(SingleFlightTest, ConcurrentCallsShareOneResult) {
+    SingleFlight<std::string> flights;
+    std::atomic<int> executions = 0;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> leaderStarted;
+
+    auto leader = std::async(std::launch::async, [&] {
+        return flights.Do("torneo/matches", [&] {
+            ++executions;
+            leaderStarted.set_value();
+            released.wait();
+            return std::string(R"([{"id":"m1"}])");
+        });
+    });
+    leaderStarted.get_future().wait();
+
+    std::vector<std::future<std::shared_ptr<const std::string>>> followers;
+    for (int i = 0; i < 8; ++i) {
+        followers.push_back(std::async(std::launch::async, [&] {
+            return flights.Do("torneo/matches", [&] {
+                ++executions;
+                return std::string("otro");
+            });
+        }));
+    }
+    // el lider se libera solo cuando los 8 seguidores estan esperando su resultado
+    while (flights.Followers("torneo/matches") < followers.size()) {
+        std::this_thread::yield();
+    }
+    release.set_value();
+
+    const auto result = leader.get();
+    for (auto& follower : followers) {
+        EXPECT_EQ(result, follower.get());
+    }
+    EXPECT_EQ(R"([{"id":"m1"}])", *result);
+    EXPECT_EQ(1, executions.load());
+}
+
+// Validar que las claves distintas no se agrupan y que no se recuerda el resultado al terminar
+TEST(SingleFlightTest, DistinctKeysAndSequentialCallsRunAgain) {
+    SingleFlight<int> flights;
+    int executions = 0;
+
+    EXPECT_EQ(1, *flights.Do("a", [&] { return ++executions; }));
+    EXPECT_EQ(2, *flights.Do("b", [&] { return ++executions; }));
+    EXPECT_EQ(3, *flights.Do("a", [&] { return ++executions; }));
+}
+
+// Validar que la excepcion del lider llega al llamador y la clave queda libre
+TEST(SingleFlightTest, ExceptionPropagates) {
+    SingleFlight<int> flights;
+
+    EXPECT_THROW(flights.Do("a", []() -> int { throw std::runtime_error("db"); }), std::runtime_error);
+    EXPECT_EQ(7, *flights.Do("a", [] { return 7; }));
+}
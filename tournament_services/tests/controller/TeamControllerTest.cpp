@@ -13,8 +13,11 @@ class TeamDelegateMock : public ITeamDelegate {
 public:
   MOCK_METHOD((std::expected<std::shared_ptr<domain::Team>, Error>), GetTeam,
               (std::string_view id), (override));
-  MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>), GetAllTeams, (), (override));
+  MOCK_METHOD((std::expected<std::vector<domain::Team>, Error>), GetAllTeams, (), (override));
+  MOCK_METHOD((std::expected<std::string, Error>), GetAllTeamsJson, (), (override));
   MOCK_METHOD((std::expected<std::string, Error>), CreateTeam, (const domain::Team&), (override));
+  MOCK_METHOD((std::expected<std::vector<std::expected<std::string, Error>>, Error>), CreateTeams,
+              (const std::vector<domain::Team>&), (override));
   MOCK_METHOD((std::expected<std::string, Error>), UpdateTeam, (const domain::Team&), (override));
   MOCK_METHOD((std::expected<void, Error>), DeleteTeam, (std::string_view id), (override));
 };
@@ -66,6 +69,49 @@ TEST_F(TeamControllerTest, CreateTeam_Conflict) {
   EXPECT_EQ(crow::CONFLICT, response.code);
 }
 
+// Tests de CreateTeams
+
+// Validar alta masiva en NDJSON con un duplicado reportado por equipo. Response 207
+TEST_F(TeamControllerTest, CreateTeams_NdjsonWithDuplicate) {
+  std::vector<domain::Team> captured;
+  EXPECT_CALL(*teamDelegateMock, CreateTeams(testing::_))
+    .WillOnce(testing::DoAll(testing::SaveArg<0>(&captured),
+                             testing::Return(std::vector<std::expected<std::string, Error>>{
+                               "550e8400-e29b-41d4-a716-446655440000", std::unexpected(Error::DUPLICATE)})));
+
+  crow::request request;
+  request.add_header("Content-Type", "application/x-ndjson");
+  request.body = "{\"name\": \"Lobos\"}\r\n\n{\"name\": \"Osos\"}\n";
+
+  crow::response response = teamController->createTeams(request);
+
+  EXPECT_EQ(207, response.code);
+  ASSERT_EQ(2, captured.size());
+  EXPECT_EQ("Osos", captured[1].Name);
+  const auto body = nlohmann::json::parse(response.body);
+  EXPECT_EQ(201, body[0]["status"]);
+  EXPECT_EQ("550e8400-e29b-41d4-a716-446655440000", body[0]["id"]);
+  EXPECT_EQ(409, body[1]["status"]);
+}
+
+// Validar alta masiva con arreglo JSON: todos creados. Response 201; un equipo invalido indica su posicion. Response 400
+TEST_F(TeamControllerTest, CreateTeams_Array) {
+  EXPECT_CALL(*teamDelegateMock, CreateTeams(testing::SizeIs(2)))
+    .WillOnce(testing::Return(std::vector<std::expected<std::string, Error>>{"id-1", "id-2"}));
+
+  crow::request request;
+  request.body = R"([{"name": "Lobos"}, {"name": "Osos"}])";
+  crow::response response = teamController->createTeams(request);
+  EXPECT_EQ(crow::CREATED, response.code);
+  EXPECT_EQ("id-2", nlohmann::json::parse(response.body)[1]["id"]);
+
+  crow::request invalid;
+  invalid.body = R"([{"name": "Lobos"}, {"name": 7}])";
+  crow::response rejected = teamController->createTeams(invalid);
+  EXPECT_EQ(crow::BAD_REQUEST, rejected.code);
+  EXPECT_EQ("[1].name", nlohmann::json::parse(rejected.body)["field"]);
+}
+
 // Tests de GetTeam
 
 // Validar respuesta exitosa y contenido. Response 200
@@ -78,7 +124,7 @@ TEST_F(TeamControllerTest, GetTeamById_Ok) {
   EXPECT_CALL(*teamDelegateMock, GetTeam(std::string_view(teamId)))
     .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Team>, Error>{std::in_place, expectedTeam}));
 
-  crow::response response = teamController->getTeam(teamId);
+  crow::response response = teamController->getTeam(crow::request{}, teamId);
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
@@ -93,7 +139,7 @@ TEST_F(TeamControllerTest, GetTeamById_NotFound) {
   EXPECT_CALL(*teamDelegateMock, GetTeam(std::string_view(teamId)))
       .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Team>, Error>{std::unexpected(Error::NOT_FOUND)}));
 
-  crow::response response = teamController->getTeam(teamId);
+  crow::response response = teamController->getTeam(crow::request{}, teamId);
 
   EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
@@ -102,41 +148,45 @@ TEST_F(TeamControllerTest, GetTeamById_NotFound) {
 
 // Validar respuesta exitosa con lista de equipos. Response 200
 TEST_F(TeamControllerTest, GetAllTeams_Ok) {
-  std::vector<std::shared_ptr<domain::Team>> teams;
+  std::vector<domain::Team> teams;
   
-  auto team1 = std::make_shared<domain::Team>();
-  team1->Id = "550e8400-e29b-41d4-a716-446655440001";
-  team1->Name = "Team One";
+  domain::Team team1;
+  team1.Id = "550e8400-e29b-41d4-a716-446655440001";
+  team1.Name = "Team One";
   
-  auto team2 = std::make_shared<domain::Team>();
-  team2->Id = "550e8400-e29b-41d4-a716-446655440002";
-  team2->Name = "Team Two";
+  domain::Team team2;
+  team2.Id = "550e8400-e29b-41d4-a716-446655440002";
+  team2.Name = "Team Two";
   
   teams.push_back(team1);
   teams.push_back(team2);
 
-  EXPECT_CALL(*teamDelegateMock, GetAllTeams())
-    .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>{std::in_place, teams}));
+  nlohmann::json rendered = nlohmann::json::array();
+  for (const auto& team : teams) {
+    rendered.push_back({{"id", team.Id}, {"name", team.Name}});
+  }
+  EXPECT_CALL(*teamDelegateMock, GetAllTeamsJson())
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, rendered.dump()}));
 
-  crow::response response = teamController->getAllTeams();
+  crow::response response = teamController->getAllTeams(crow::request{});
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
   ASSERT_EQ(jsonResponse.size(), teams.size());
-  EXPECT_EQ(jsonResponse[0]["id"].get<std::string>(), teams[0]->Id);
-  EXPECT_EQ(jsonResponse[0]["name"].get<std::string>(), teams[0]->Name);
-  EXPECT_EQ(jsonResponse[1]["id"].get<std::string>(), teams[1]->Id);
-  EXPECT_EQ(jsonResponse[1]["name"].get<std::string>(), teams[1]->Name);
+  EXPECT_EQ(jsonResponse[0]["id"].get<std::string>(), teams[0].Id);
+  EXPECT_EQ(jsonResponse[0]["name"].get<std::string>(), teams[0].Name);
+  EXPECT_EQ(jsonResponse[1]["id"].get<std::string>(), teams[1].Id);
+  EXPECT_EQ(jsonResponse[1]["name"].get<std::string>(), teams[1].Name);
 }
 
 // Validar respuesta exitosa con lista vacia. Response 200
 TEST_F(TeamControllerTest, GetAllTeams_Empty) {
-  std::vector<std::shared_ptr<domain::Team>> emptyTeams;
+  std::vector<domain::Team> emptyTeams;
 
-  EXPECT_CALL(*teamDelegateMock, GetAllTeams())
-    .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>{std::in_place, emptyTeams}));
+  EXPECT_CALL(*teamDelegateMock, GetAllTeamsJson())
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, "[]"}));
 
-  crow::response response = teamController->getAllTeams();
+  crow::response response = teamController->getAllTeams(crow::request{});
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
@@ -10,7 +10,7 @@ class TournamentDelegateMock : public ITournamentDelegate {
 public:
   MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, Error>), GetTournament,
               (std::string_view id), (override));
-  MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>), ReadAll, (), (override));
+  MOCK_METHOD((std::expected<std::vector<domain::Tournament>, Error>), ReadAll, (), (override));
   MOCK_METHOD((std::expected<std::string, Error>), CreateTournament, (const domain::Tournament&), (override));
   MOCK_METHOD((std::expected<std::string, Error>), UpdateTournament, (const domain::Tournament&), (override));
   MOCK_METHOD((std::expected<void, Error>), DeleteTournament, (std::string_view id), (override));
@@ -73,7 +73,7 @@ TEST_F(TournamentControllerTest, GetTournamentById_Ok) {
   EXPECT_CALL(*tournamentDelegateMock, GetTournament(tournamentId))
       .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, Error>(tournament)));
 
-  auto response = tournamentController->getTournament(tournamentId);
+  auto response = tournamentController->getTournament(crow::request{}, tournamentId);
 
   EXPECT_EQ(response.code, crow::OK);
   auto jsonResponse = nlohmann::json::parse(response.body);
@@ -87,7 +87,7 @@ TEST_F(TournamentControllerTest, GetTournamentById_NotFound) {
   EXPECT_CALL(*tournamentDelegateMock, GetTournament(tournamentId))
       .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, Error>(std::unexpected(Error::NOT_FOUND))));
 
-  auto response = tournamentController->getTournament(tournamentId);
+  auto response = tournamentController->getTournament(crow::request{}, tournamentId);
 
   EXPECT_EQ(response.code, crow::NOT_FOUND);
 }
@@ -96,16 +96,16 @@ TEST_F(TournamentControllerTest, GetTournamentById_NotFound) {
 
 // Validar respuesta exitosa con lista de torneos. Response 200
 TEST_F(TournamentControllerTest, GetAllTournaments_Ok) {
-  auto tournament1 = std::make_shared<domain::Tournament>("Tournament 1");
-  tournament1->Id() = "tournament-1";
-  auto tournament2 = std::make_shared<domain::Tournament>("Tournament 2");
-  tournament2->Id() = "tournament-2";
-  std::vector<std::shared_ptr<domain::Tournament>> tournaments = {tournament1, tournament2};
+  domain::Tournament tournament1("Tournament 1");
+  tournament1.Id() = "tournament-1";
+  domain::Tournament tournament2("Tournament 2");
+  tournament2.Id() = "tournament-2";
+  std::vector<domain::Tournament> tournaments = {tournament1, tournament2};
 
   EXPECT_CALL(*tournamentDelegateMock, ReadAll())
-      .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>(tournaments)));
+      .WillOnce(testing::Return(std::expected<std::vector<domain::Tournament>, Error>(tournaments)));
 
-  auto response = tournamentController->ReadAll();
+  auto response = tournamentController->ReadAll(crow::request{});
 
   EXPECT_EQ(response.code, crow::OK);
   auto jsonResponse = nlohmann::json::parse(response.body);
@@ -114,12 +114,12 @@ TEST_F(TournamentControllerTest, GetAllTournaments_Ok) {
 
 // Validar respuesta exitosa con lista vacia. Response 200
 TEST_F(TournamentControllerTest, GetAllTournaments_Empty) {
-  std::vector<std::shared_ptr<domain::Tournament>> emptyTournaments;
+  std::vector<domain::Tournament> emptyTournaments;
 
   EXPECT_CALL(*tournamentDelegateMock, ReadAll())
-      .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>(emptyTournaments)));
+      .WillOnce(testing::Return(std::expected<std::vector<domain::Tournament>, Error>(emptyTournaments)));
 
-  auto response = tournamentController->ReadAll();
+  auto response = tournamentController->ReadAll(crow::request{});
 
   EXPECT_EQ(response.code, crow::OK);
   auto jsonResponse = nlohmann::json::parse(response.body);
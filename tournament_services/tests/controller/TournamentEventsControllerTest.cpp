@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <crow.h>
+#include <memory>
+#include <string>
+
+#include "controller/TournamentEventsController.hpp"
+#include "delegate/ITournamentDelegate.hpp"
+#include "events/TournamentEventHub.hpp"
+
+namespace {
+  class EventsTournamentDelegateMock : public ITournamentDelegate {
+  public:
+    MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, Error>), GetTournament,
+                (std::string_view id), (override));
+    MOCK_METHOD((std::expected<std::vector<domain::Tournament>, Error>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), CreateTournament, (const domain::Tournament&), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), UpdateTournament, (const domain::Tournament&), (override));
+    MOCK_METHOD((std::expected<void, Error>), DeleteTournament, (std::string_view id), (override));
+  };
+
+  const std::string TOURNAMENT_ID = "12345678-1234-1234-1234-123456789abc";
+}
+
+class TournamentEventsControllerTest : public ::testing::Test {
+protected:
+  std::shared_ptr<EventsTournamentDelegateMock> tournamentDelegateMock = std::make_shared<EventsTournamentDelegateMock>();
+  std::shared_ptr<events::TournamentEventHub> hub = std::make_shared<events::TournamentEventHub>();
+  std::shared_ptr<TournamentEventsController> controller = std::make_shared<TournamentEventsController>(tournamentDelegateMock, hub);
+  // hilo de io de la conexion: las respuestas retenidas se completan ahi
+  asio::io_context connection;
+
+  crow::request Request() {
+    crow::request request;
+    request.io_context = &connection;
+    return request;
+  }
+
+  const metrics::RouteId route = metrics::Registry::Instance().RegisterRoute("GET", "/tournaments/<string>/events");
+
+  AsyncResponse Async(const crow::request& request, crow::response& response) {
+    return AsyncResponse(request, response, metrics::PendingRequest(route));
+  }
+
+  void RunConnection() {
+    connection.restart();
+    connection.run();
+  }
+};
+
+// Validar que solo el primer espectador consulta el torneo y que la respuesta queda abierta hasta el cambio. Response 200
+TEST_F(TournamentEventsControllerTest, GetEvents_FirstViewerOpensChannel) {
+  EXPECT_CALL(*tournamentDelegateMock, GetTournament(std::string_view(TOURNAMENT_ID)))
+    .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, Error>{
+      std::in_place, std::make_shared<domain::Tournament>()}));
+
+  crow::request first = Request();
+  crow::response held;
+  controller->getEvents(first, Async(first, held), TOURNAMENT_ID);
+  EXPECT_FALSE(held.completed);
+  EXPECT_EQ(1, hub->Waiting());
+
+  hub->Publish(TOURNAMENT_ID, "match", R"({"id":"m1"})");
+  // se completa en el hilo de la conexion, no en el que publica
+  EXPECT_FALSE(held.completed);
+  RunConnection();
+
+  EXPECT_TRUE(held.completed);
+  EXPECT_EQ(crow::OK, held.code);
+  EXPECT_EQ("text/event-stream", held.get_header_value("content-type"));
+  EXPECT_EQ("retry: 500\n\nid: 1\nevent: match\ndata: {\"id\":\"m1\"}\n\n", held.body);
+
+  crow::request behind = Request();
+  behind.add_header("Last-Event-ID", "0");
+  crow::response update;
+  controller->getEvents(behind, Async(behind, update), TOURNAMENT_ID);
+  RunConnection();
+  EXPECT_TRUE(update.completed);
+  EXPECT_EQ("retry: 500\n\nid: 1\nevent: match\ndata: {\"id\":\"m1\"}\n\n", update.body);
+}
+
+// Validar que un id en mayusculas recibe los cambios publicados con el id en minusculas de la base. Response 200
+TEST_F(TournamentEventsControllerTest, GetEvents_UppercaseIdReceivesChanges) {
+  EXPECT_CALL(*tournamentDelegateMock, GetTournament(std::string_view(TOURNAMENT_ID)))
+    .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, Error>{
+      std::in_place, std::make_shared<domain::Tournament>()}));
+
+  crow::request request = Request();
+  crow::response held;
+  controller->getEvents(request, Async(request, held), "12345678-1234-1234-1234-123456789ABC");
+  hub->Publish(TOURNAMENT_ID, "match", R"({"id":"m1"})");
+  RunConnection();
+
+  EXPECT_TRUE(held.completed);
+  EXPECT_EQ("retry: 500\n\nid: 1\nevent: match\ndata: {\"id\":\"m1\"}\n\n", held.body);
+}
+
+// Validar que sin cambios la respuesta se cierra al vencer el keep-alive con el id actual. Response 200
+TEST_F(TournamentEventsControllerTest, GetEvents_KeepAliveTimeout) {
+  hub->Open(TOURNAMENT_ID, std::chrono::steady_clock::now());
+
+  crow::request request = Request();
+  request.add_header("Last-Event-ID", "0");
+  crow::response held;
+  controller->getEvents(request, Async(request, held), TOURNAMENT_ID);
+  hub->Expire(std::chrono::steady_clock::now());
+  RunConnection();
+  EXPECT_FALSE(held.completed);
+
+  hub->Expire(std::chrono::steady_clock::now() + TournamentEventsController::HOLD_TIMEOUT);
+  RunConnection();
+  EXPECT_TRUE(held.completed);
+  EXPECT_EQ(crow::OK, held.code);
+  EXPECT_EQ("retry: 500\n\nid: 0\n\n", held.body);
+  EXPECT_EQ(0, hub->Waiting());
+}
+
+// Validar torneo inexistente. Response 404; id invalido. Response 400
+TEST_F(TournamentEventsControllerTest, GetEvents_Errors) {
+  EXPECT_CALL(*tournamentDelegateMock, GetTournament(testing::_))
+    .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, Error>{std::unexpected(Error::NOT_FOUND)}));
+
+  crow::request request = Request();
+  crow::response missing;
+  controller->getEvents(request, Async(request, missing), TOURNAMENT_ID);
+  RunConnection();
+  EXPECT_TRUE(missing.completed);
+  EXPECT_EQ(crow::NOT_FOUND, missing.code);
+  EXPECT_FALSE(hub->IsOpen(TOURNAMENT_ID));
+
+  crow::response invalid;
+  controller->getEvents(request, Async(request, invalid), "no-es-uuid");
+  RunConnection();
+  EXPECT_TRUE(invalid.completed);
+  EXPECT_EQ(crow::BAD_REQUEST, invalid.code);
+}
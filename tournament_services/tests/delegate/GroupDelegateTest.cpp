@@ -3,6 +3,7 @@
 #include <memory>
 #include <expected>
 #include <pqxx/pqxx>
+#include <nlohmann/json.hpp>
 
 #include "domain/Group.hpp"
 #include "domain/Team.hpp"
@@ -23,16 +24,17 @@ public:
 
 class MockGroupRepository : public IGroupRepository {
     public:
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, FindByTournamentId, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(std::vector<domain::Group>, FindByTournamentId, (const std::string_view& tournamentId), (override));
     MOCK_METHOD(std::string, Create, (const domain::Group& entity), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, ReadById, (std::string id), (override));
     MOCK_METHOD(std::string, Update, (const domain::Group& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Group>, ReadAll, (), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndGroupId, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndTeamId, (const std::string_view& tournamentId, const std::string_view& teamId), (override));   
-    MOCK_METHOD(std::shared_ptr<domain::Group>, FindByGroupIdAndTeamId, (const std::string_view& groupId, const std::string_view& teamId), (override));
-    MOCK_METHOD(void, UpdateGroupAddTeam, (const std::string_view& groupId, const std::shared_ptr<domain::Team> & team), (override));
+    MOCK_METHOD(std::vector<std::string>, FindTeamIdsInGroup, (const std::string_view& groupId, const std::vector<std::string>& teamIds), (override));
+    MOCK_METHOD(void, UpdateGroupAddTeams, (const std::string_view& groupId, const std::vector<domain::Team>& teams), (override));
+    MOCK_METHOD(std::string, FindByTournamentIdAsJson, (const std::string_view& tournamentId), (override));
 };
 
 // Solo implementan Interfaces
@@ -42,7 +44,7 @@ public:
     MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
 };
 
 class MockTeamRepository : public IRepository<domain::Team, std::string_view> {
@@ -51,7 +53,8 @@ public:
     MOCK_METHOD(std::string_view, Create, (const domain::Team& entity), (override));
     MOCK_METHOD(std::string_view, Update, (const domain::Team& entity), (override));
     MOCK_METHOD(void, Delete, (std::string_view id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Team>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Team>, ReadByIds, (const std::vector<std::string>& ids));
 };
 
 // Necesario para que puedan ser usadas por GroupDeleagate
@@ -78,12 +81,12 @@ public:
     std::string Create(const domain::Tournament& entity) override { return mock->Create(entity); }
     std::string Update(const domain::Tournament& entity) override { return mock->Update(entity); }
     void Delete(std::string id) override { mock->Delete(id); }
-    std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override { return mock->ReadAll(); }
+    std::vector<domain::Tournament> ReadAll() override { return mock->ReadAll(); }
 };
 
 class TeamRepositoryAdapter : public TeamRepository {
 private:
-    std::shared_ptr<IRepository<domain::Team, std::string_view>> mock;
+    std::shared_ptr<MockTeamRepository> mock;
     
     static std::shared_ptr<IDbConnectionProvider> CreateDummyProvider() {
         static auto provider = std::make_shared<DummyConnectionProvider>();
@@ -97,14 +100,15 @@ private:
     };
 
 public:
-    TeamRepositoryAdapter(std::shared_ptr<IRepository<domain::Team, std::string_view>> mockRepo) 
+    TeamRepositoryAdapter(std::shared_ptr<MockTeamRepository> mockRepo) 
         : TeamRepository(CreateDummyProvider()), mock(mockRepo) {}
     
     std::shared_ptr<domain::Team> ReadById(std::string_view id) override { return mock->ReadById(id); }
     std::string_view Create(const domain::Team& entity) override { return mock->Create(entity); }
     std::string_view Update(const domain::Team& entity) override { return mock->Update(entity); }
     void Delete(std::string_view id) override { mock->Delete(id); }
-    std::vector<std::shared_ptr<domain::Team>> ReadAll() override { return mock->ReadAll(); }
+    std::vector<domain::Team> ReadAll() override { return mock->ReadAll(); }
+    std::vector<domain::Team> ReadByIds(const std::vector<std::string>& ids) override { return mock->ReadByIds(ids); }
 };
 
 class GroupDelegateTest : public ::testing::Test {
@@ -313,50 +317,54 @@ TEST_F(GroupDelegateTest, UpdateGroup_NotFound) {
 
 // Tests de UpdateTeams
 
-// Validar agregar equipo exitosamente a grupo y que se publique mensaje
+// Validar alta de varios equipos: una consulta por validacion, una escritura y un solo evento
 TEST_F(GroupDelegateTest, UpdateTeams_Ok) {
-    domain::Team team;
-    team.Id = validTeamId;
-    team.Name = "Test Team";
-    std::vector<domain::Team> teams = {team};
-    
+    const std::string secondTeamId = "abcdef01-2345-6789-abcd-ef012345678a";
+    std::vector<domain::Team> teams = {{validTeamId, ""}, {secondTeamId, ""}};
+
     auto tournament = std::make_shared<domain::Tournament>(domain::Tournament{"Tournament Name"});
     tournament->Id() = validTournamentId;
-    
+
     auto group = std::make_shared<domain::Group>(domain::Group{"Test Group", validGroupId});
     group->TournamentId() = validTournamentId;
-    
-    auto persistedTeam = std::make_shared<domain::Team>();
-    persistedTeam->Id = validTeamId;
-    persistedTeam->Name = "Test Team";
 
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(validTournamentId)))
         .WillOnce(testing::Return(tournament));
-    
+
     EXPECT_CALL(*mockGroupRepository, FindByTournamentIdAndGroupId(
-        testing::Eq(validTournamentId), 
+        testing::Eq(validTournamentId),
         testing::Eq(validGroupId)))
         .WillOnce(testing::Return(group));
-    
-    EXPECT_CALL(*mockGroupRepository, FindByGroupIdAndTeamId(
-        testing::Eq(validGroupId), 
-        testing::Eq(validTeamId)))
-        .WillOnce(testing::Return(nullptr));
-    
-    EXPECT_CALL(*mockTeamRepository, ReadById(testing::Eq(validTeamId)))
-        .WillOnce(testing::Return(persistedTeam));
-    
-    EXPECT_CALL(*mockGroupRepository, UpdateGroupAddTeam(
-        testing::Eq(validGroupId), 
+
+    EXPECT_CALL(*mockGroupRepository, FindTeamIdsInGroup(
+        testing::Eq(validGroupId),
+        testing::ElementsAre(validTeamId, secondTeamId)))
+        .WillOnce(testing::Return(std::vector<std::string>{}));
+
+    // la base devuelve los equipos en cualquier orden
+    EXPECT_CALL(*mockTeamRepository, ReadByIds(testing::ElementsAre(validTeamId, secondTeamId)))
+        .WillOnce(testing::Return(std::vector<domain::Team>{{secondTeamId, "Second Team"}, {validTeamId, "Test Team"}}));
+
+    EXPECT_CALL(*mockGroupRepository, UpdateGroupAddTeams(
+        testing::Eq(validGroupId),
         testing::_))
-        .WillOnce(testing::WithArg<1>(testing::Invoke([&](const std::shared_ptr<domain::Team>& t) {
-            EXPECT_EQ(t->Id, validTeamId);
-            EXPECT_EQ(t->Name, "Test Team");
+        .WillOnce(testing::WithArg<1>(testing::Invoke([&](const std::vector<domain::Team>& members) {
+            ASSERT_EQ(2, members.size());
+            EXPECT_EQ(members[0].Id, validTeamId);
+            EXPECT_EQ(members[0].Name, "Test Team");
+            EXPECT_EQ(members[1].Id, secondTeamId);
         })));
 
+    std::string message;
+    EXPECT_CALL(*mockMessageProducer, SendMessage(testing::_, testing::Eq("tournament.team-add")))
+        .WillOnce(testing::WithArg<0>(testing::Invoke([&](const std::string_view& sent) { message = sent; })));
+
     auto result = groupDelegate->UpdateTeams(validTournamentId, validGroupId, teams);
 
     ASSERT_TRUE(result.has_value());
+    const auto event = nlohmann::json::parse(message);
+    EXPECT_EQ(validGroupId, event["groupId"]);
+    EXPECT_EQ(2, event["teamIds"].size());
 }
 
 // Validar error cuando equipo no existe
@@ -365,28 +373,28 @@ TEST_F(GroupDelegateTest, UpdateTeams_TeamNotFound) {
     team.Id = validTeamId;
     team.Name = "Non-existent Team";
     std::vector<domain::Team> teams = {team};
-    
+
     auto tournament = std::make_shared<domain::Tournament>(domain::Tournament{"Tournament Name"});
     tournament->Id() = validTournamentId;
-    
+
     auto group = std::make_shared<domain::Group>(domain::Group{"Test Group", validGroupId});
     group->TournamentId() = validTournamentId;
 
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(validTournamentId)))
         .WillOnce(testing::Return(tournament));
-    
+
     EXPECT_CALL(*mockGroupRepository, FindByTournamentIdAndGroupId(
-        testing::Eq(validTournamentId), 
+        testing::Eq(validTournamentId),
         testing::Eq(validGroupId)))
         .WillOnce(testing::Return(group));
-    
-    EXPECT_CALL(*mockGroupRepository, FindByGroupIdAndTeamId(
-        testing::Eq(validGroupId), 
-        testing::Eq(validTeamId)))
-        .WillOnce(testing::Return(nullptr));
-    
-    EXPECT_CALL(*mockTeamRepository, ReadById(testing::Eq(validTeamId)))
-        .WillOnce(testing::Return(nullptr));
+
+    EXPECT_CALL(*mockGroupRepository, FindTeamIdsInGroup(testing::Eq(validGroupId), testing::_))
+        .WillOnce(testing::Return(std::vector<std::string>{}));
+
+    EXPECT_CALL(*mockTeamRepository, ReadByIds(testing::_))
+        .WillOnce(testing::Return(std::vector<domain::Team>{}));
+    EXPECT_CALL(*mockGroupRepository, UpdateGroupAddTeams(testing::_, testing::_)).Times(0);
+    EXPECT_CALL(*mockMessageProducer, SendMessage(testing::_, testing::_)).Times(0);
 
     auto result = groupDelegate->UpdateTeams(validTournamentId, validGroupId, teams);
 
@@ -394,6 +402,30 @@ TEST_F(GroupDelegateTest, UpdateTeams_TeamNotFound) {
     EXPECT_EQ(result.error(), Error::UNPROCESSABLE_ENTITY);
 }
 
+// Validar duplicado cuando un equipo ya pertenece al grupo o se repite en la peticion
+TEST_F(GroupDelegateTest, UpdateTeams_Duplicate) {
+    auto tournament = std::make_shared<domain::Tournament>(domain::Tournament{"Tournament Name"});
+    tournament->Id() = validTournamentId;
+    auto group = std::make_shared<domain::Group>(domain::Group{"Test Group", validGroupId});
+    group->TournamentId() = validTournamentId;
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(validTournamentId)))
+        .WillOnce(testing::Return(tournament));
+    EXPECT_CALL(*mockGroupRepository, FindByTournamentIdAndGroupId(testing::Eq(validTournamentId), testing::Eq(validGroupId)))
+        .WillOnce(testing::Return(group));
+    EXPECT_CALL(*mockGroupRepository, FindTeamIdsInGroup(testing::Eq(validGroupId), testing::_))
+        .WillOnce(testing::Return(std::vector<std::string>{validTeamId}));
+    EXPECT_CALL(*mockTeamRepository, ReadByIds(testing::_)).Times(0);
+
+    auto member = groupDelegate->UpdateTeams(validTournamentId, validGroupId, {{validTeamId, ""}});
+    ASSERT_FALSE(member.has_value());
+    EXPECT_EQ(member.error(), Error::DUPLICATE);
+
+    auto repeated = groupDelegate->UpdateTeams(validTournamentId, validGroupId, {{validTeamId, ""}, {validTeamId, ""}});
+    ASSERT_FALSE(repeated.has_value());
+    EXPECT_EQ(repeated.error(), Error::DUPLICATE);
+}
+
 // Validar error cuando grupo esta lleno
 TEST_F(GroupDelegateTest, UpdateTeams_GroupFull) {
     domain::Team team;
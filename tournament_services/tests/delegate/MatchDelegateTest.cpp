@@ -2,6 +2,7 @@
 #include <gmock/gmock.h>
 #include <memory>
 #include <expected>
+#include <nlohmann/json.hpp>
 
 #include "domain/Match.hpp"
 #include "delegate/MatchDelegate.hpp"
@@ -17,16 +18,23 @@ class MockMatchRepository : public IMatchRepository {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndMatchId,
                 (const std::string_view& tournamentId, const std::string_view& matchId), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByTournamentId,
-                (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(std::pmr::vector<domain::Match>, FindByTournamentId,
+                (const std::string_view& tournamentId, const serialization::FieldSet<domain::Match>& fields), (override));
     MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndName,
                 (const std::string_view& tournamentId, const std::string_view& name), (override));
     MOCK_METHOD(std::vector<std::string>, CreateBulk, (const std::vector<domain::Match>& matches), (override));
     MOCK_METHOD(void, Update, (const std::string_view& matchId, const domain::Match& match), (override));
     MOCK_METHOD(void, UpdateMatchScore, (const std::string_view& matchId, const domain::Score& score), (override));
+    MOCK_METHOD(std::vector<std::string>, UpdateMatchScores, (const std::vector<domain::Match>& matches), (override));
     MOCK_METHOD(bool, MatchesExistForTournament, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(std::string, FindByTournamentIdAsJson,
+                (const std::string_view& tournamentId, const serialization::FieldSet<domain::Match>& fields), (override));
+    MOCK_METHOD(std::optional<std::string>, FindVersionByTournamentId, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(std::optional<std::pmr::vector<domain::BracketMatch>>, FindBracketByTournamentId, (const std::string_view& tournamentId), (override));
 };
 
+const auto ALL_FIELDS = serialization::FieldSet<domain::Match>::All();
+
 // Mock del repositorio de Tournaments
 class MockTournamentRepository : public IRepository<domain::Tournament, std::string> {
 public:
@@ -34,7 +42,7 @@ public:
     MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
 };
 
 // Adapter para que TournamentRepository pueda usar el mock
@@ -61,7 +69,7 @@ public:
     std::string Create(const domain::Tournament& entity) override { return mock->Create(entity); }
     std::string Update(const domain::Tournament& entity) override { return mock->Update(entity); }
     void Delete(std::string id) override { mock->Delete(id); }
-    std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override { return mock->ReadAll(); }
+    std::vector<domain::Tournament> ReadAll() override { return mock->ReadAll(); }
 };
 
 // Mock del productor de mensajes
@@ -103,23 +111,23 @@ TEST_F(MatchDelegateTest, GetMatches_Ok) {
     auto tournament = std::make_shared<domain::Tournament>("Test Tournament");
     tournament->Id() = tournamentId;
 
-    auto match1 = std::make_shared<domain::Match>();
-    match1->Id() = "660e8400-e29b-41d4-a716-446655440001";
-    match1->TournamentId() = tournamentId;
+    domain::Match match1;
+    match1.Id() = "660e8400-e29b-41d4-a716-446655440001";
+    match1.TournamentId() = tournamentId;
 
-    auto match2 = std::make_shared<domain::Match>();
-    match2->Id() = "770e8400-e29b-41d4-a716-446655440002";
-    match2->TournamentId() = tournamentId;
+    domain::Match match2;
+    match2.Id() = "770e8400-e29b-41d4-a716-446655440002";
+    match2.TournamentId() = tournamentId;
 
-    std::vector<std::shared_ptr<domain::Match>> matches = {match1, match2};
+    std::pmr::vector<domain::Match> matches = {match1, match2};
 
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
         .WillOnce(testing::Return(tournament));
 
-    EXPECT_CALL(*mockMatchRepository, FindByTournamentId(tournamentId))
+    EXPECT_CALL(*mockMatchRepository, FindByTournamentId(tournamentId, ALL_FIELDS))
         .WillOnce(testing::Return(matches));
 
-    auto result = matchDelegate->GetMatches(tournamentId);
+    auto result = matchDelegate->GetMatches(tournamentId, ALL_FIELDS);
 
     ASSERT_TRUE(result.has_value());
     EXPECT_EQ(result.value().size(), 2);
@@ -132,7 +140,7 @@ TEST_F(MatchDelegateTest, GetMatches_TournamentNotFound) {
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
         .WillOnce(testing::Return(nullptr));
 
-    auto result = matchDelegate->GetMatches(tournamentId);
+    auto result = matchDelegate->GetMatches(tournamentId, ALL_FIELDS);
 
     ASSERT_FALSE(result.has_value());
     EXPECT_EQ(result.error(), Error::NOT_FOUND);
@@ -142,7 +150,7 @@ TEST_F(MatchDelegateTest, GetMatches_TournamentNotFound) {
 TEST_F(MatchDelegateTest, GetMatches_InvalidFormat) {
     std::string invalidTournamentId = "invalid-id-format!@#";
 
-    auto result = matchDelegate->GetMatches(invalidTournamentId);
+    auto result = matchDelegate->GetMatches(invalidTournamentId, ALL_FIELDS);
 
     ASSERT_FALSE(result.has_value());
     EXPECT_EQ(result.error(), Error::INVALID_FORMAT);
@@ -155,20 +163,100 @@ TEST_F(MatchDelegateTest, GetMatches_Empty) {
     auto tournament = std::make_shared<domain::Tournament>("Test Tournament");
     tournament->Id() = tournamentId;
 
-    std::vector<std::shared_ptr<domain::Match>> emptyMatches;
+    std::pmr::vector<domain::Match> emptyMatches;
 
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
         .WillOnce(testing::Return(tournament));
 
-    EXPECT_CALL(*mockMatchRepository, FindByTournamentId(tournamentId))
+    EXPECT_CALL(*mockMatchRepository, FindByTournamentId(tournamentId, ALL_FIELDS))
         .WillOnce(testing::Return(emptyMatches));
 
-    auto result = matchDelegate->GetMatches(tournamentId);
+    auto result = matchDelegate->GetMatches(tournamentId, ALL_FIELDS);
 
     ASSERT_TRUE(result.has_value());
     EXPECT_EQ(result.value().size(), 0);
 }
 
+// Validar que la proyeccion pedida llega al repositorio para que solo lea esos campos
+TEST_F(MatchDelegateTest, GetMatches_ProjectionPushedDown) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+    const auto fields = serialization::FieldSet<domain::Match>::Parse("id,score");
+    ASSERT_TRUE(fields.has_value());
+
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament");
+    tournament->Id() = tournamentId;
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
+        .WillOnce(testing::Return(tournament));
+    EXPECT_CALL(*mockMatchRepository, FindByTournamentId(tournamentId, *fields))
+        .WillOnce(testing::Return(std::pmr::vector<domain::Match>(1)));
+
+    auto result = matchDelegate->GetMatches(tournamentId, *fields);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value().size(), 1);
+}
+
+// Validar que el JSON renderizado por el repositorio se devuelve tal cual
+TEST_F(MatchDelegateTest, GetMatchesJson_Ok) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+    std::string rendered = R"([{"id": "m1", "name": "Match 1"}])";
+
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament");
+    tournament->Id() = tournamentId;
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
+        .WillOnce(testing::Return(tournament));
+    EXPECT_CALL(*mockMatchRepository, FindByTournamentIdAsJson(testing::Eq(std::string_view(tournamentId)), ALL_FIELDS))
+        .WillOnce(testing::Return(rendered));
+
+    auto result = matchDelegate->GetMatchesJson(tournamentId, ALL_FIELDS);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), rendered);
+}
+
+// Validar error cuando el torneo no existe al renderizar en la base de datos
+TEST_F(MatchDelegateTest, GetMatchesJson_TournamentNotFound) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
+        .WillOnce(testing::Return(nullptr));
+    EXPECT_CALL(*mockMatchRepository, FindByTournamentIdAsJson(testing::_, testing::_)).Times(0);
+
+    auto result = matchDelegate->GetMatchesJson(tournamentId, ALL_FIELDS);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::NOT_FOUND);
+}
+
+// Validar que la version del listado viene del repositorio sin consultar el torneo por separado
+TEST_F(MatchDelegateTest, GetMatchesVersion_Ok) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::_)).Times(0);
+    EXPECT_CALL(*mockMatchRepository, FindVersionByTournamentId(testing::Eq(std::string_view(tournamentId))))
+        .WillOnce(testing::Return(std::optional<std::string>{"63-20251018120000000000"}));
+
+    auto result = matchDelegate->GetMatchesVersion(tournamentId);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), "63-20251018120000000000");
+}
+
+// Validar error cuando el torneo no existe al calcular la version
+TEST_F(MatchDelegateTest, GetMatchesVersion_TournamentNotFound) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+    EXPECT_CALL(*mockMatchRepository, FindVersionByTournamentId(testing::_))
+        .WillOnce(testing::Return(std::nullopt));
+
+    auto result = matchDelegate->GetMatchesVersion(tournamentId);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::NOT_FOUND);
+}
+
 // ============================================================================
 // Tests de GetMatch
 // ============================================================================
@@ -407,3 +495,98 @@ TEST_F(MatchDelegateTest, UpdateMatchScore_MessageContainsCorrectData) {
 
     ASSERT_TRUE(result.has_value());
 }
+
+// Validar que un lote de scores se escribe en una sola operacion y se publica en un solo mensaje
+TEST_F(MatchDelegateTest, UpdateMatchScores_BatchedWriteAndMessage) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+    std::vector<domain::Match> matches(3);
+    matches[0].Id() = "880e8400-e29b-41d4-a716-446655440001";
+    matches[1].Id() = "880e8400-e29b-41d4-a716-446655440002";
+    matches[2].Id() = "not-a-uuid";
+    for (auto& match : matches) {
+        match.TournamentId() = tournamentId;
+        match.MatchScore().homeTeamScore = 1;
+    }
+
+    EXPECT_CALL(*mockMatchRepository, UpdateMatchScores(testing::SizeIs(2)))
+        .WillOnce(testing::Return(std::vector<std::string>{matches[0].Id()}));
+    std::string message;
+    EXPECT_CALL(*mockMessageProducer, SendMessage(testing::_, testing::_))
+        .WillOnce(testing::SaveArg<0>(&message));
+
+    auto results = matchDelegate->UpdateMatchScores(matches);
+
+    ASSERT_EQ(3u, results.size());
+    EXPECT_EQ(matches[0].Id(), results[0].value());
+    EXPECT_EQ(Error::NOT_FOUND, results[1].error());
+    EXPECT_EQ(Error::INVALID_FORMAT, results[2].error());
+    auto events = nlohmann::json::parse(message);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(matches[0].Id(), events[0]["matchId"]);
+}
+
+// Validar que un id en mayusculas se reconoce en los ids en minusculas que devuelve la base
+TEST_F(MatchDelegateTest, UpdateMatchScores_UppercaseId) {
+    std::vector<domain::Match> matches(1);
+    matches[0].Id() = "880E8400-E29B-41D4-A716-44665544000A";
+    matches[0].TournamentId() = "550e8400-e29b-41d4-a716-446655440000";
+    matches[0].MatchScore().homeTeamScore = 2;
+
+    EXPECT_CALL(*mockMatchRepository, UpdateMatchScores(testing::SizeIs(1)))
+        .WillOnce(testing::Return(std::vector<std::string>{"880e8400-e29b-41d4-a716-44665544000a"}));
+    std::string message;
+    EXPECT_CALL(*mockMessageProducer, SendMessage(testing::_, testing::_))
+        .WillOnce(testing::SaveArg<0>(&message));
+
+    auto results = matchDelegate->UpdateMatchScores(matches);
+
+    ASSERT_EQ(1u, results.size());
+    ASSERT_TRUE(results[0].has_value());
+    EXPECT_EQ(matches[0].Id(), results[0].value());
+    auto events = nlohmann::json::parse(message);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(2, events[0]["homeTeamScore"]);
+}
+
+// Validar que el bracket se arma por seccion y ronda a partir de los nombres de los partidos
+TEST_F(MatchDelegateTest, GetBracket_AssemblesRounds) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+    const auto bracketMatch = [](std::string name, std::string homeTeamName) {
+        domain::BracketMatch match;
+        match.id = "id-" + name;
+        match.name = std::move(name);
+        match.home.teamName = std::move(homeTeamName);
+        return match;
+    };
+    EXPECT_CALL(*mockMatchRepository, FindBracketByTournamentId(testing::Eq(std::string_view(tournamentId))))
+        .WillOnce(testing::Return(std::pmr::vector<domain::BracketMatch>{
+            bracketMatch("W17", ""), bracketMatch("W1", "Team B"), bracketMatch("W0", "Team A"),
+            bracketMatch("L29", ""), bracketMatch("F1", ""), bracketMatch("X3", "")}));
+
+    auto result = matchDelegate->GetBracket(tournamentId);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(tournamentId, result->tournamentId);
+    ASSERT_EQ(5u, result->winners.size());
+    ASSERT_EQ(8u, result->losers.size());
+    ASSERT_EQ(2u, result->finals.size());
+    ASSERT_EQ(2u, result->winners[0].matches.size());
+    EXPECT_EQ("W0", result->winners[0].matches[0].name);
+    EXPECT_EQ("Team A", result->winners[0].matches[0].home.teamName);
+    EXPECT_EQ("W1", result->winners[0].matches[1].name);
+    EXPECT_EQ(2, result->winners[1].number);
+    EXPECT_EQ("W17", result->winners[1].matches[0].name);
+    EXPECT_EQ("L29", result->losers[7].matches[0].name);
+    EXPECT_EQ("F1", result->finals[1].matches[0].name);
+}
+
+// Validar error cuando el torneo no existe
+TEST_F(MatchDelegateTest, GetBracket_TournamentNotFound) {
+    EXPECT_CALL(*mockMatchRepository, FindBracketByTournamentId(testing::_))
+        .WillOnce(testing::Return(std::nullopt));
+
+    auto result = matchDelegate->GetBracket("550e8400-e29b-41d4-a716-446655440000");
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(Error::NOT_FOUND, result.error());
+}
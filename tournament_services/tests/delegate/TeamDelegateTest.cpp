@@ -6,17 +6,20 @@
 
 #include "domain/Team.hpp"
 #include "delegate/TeamDelegate.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 #include "exception/Error.hpp"
 
 // Mock del repositorio
-class MockTeamRepository : public IRepository<domain::Team, std::string_view> {
+class MockTeamRepository : public ITeamRepository {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string_view id), (override));
     MOCK_METHOD(std::string_view, Create, (const domain::Team& entity), (override));
     MOCK_METHOD(std::string_view, Update, (const domain::Team& entity), (override));
     MOCK_METHOD(void, Delete, (std::string_view id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Team>, ReadAll, (), (override));
+    MOCK_METHOD(std::string, ReadAllAsJson, (), (override));
+    MOCK_METHOD(std::vector<domain::Team>, ReadByIds, (const std::vector<std::string>& ids), (override));
+    MOCK_METHOD(std::vector<std::optional<std::string>>, CreateMany, (const std::vector<domain::Team>& teams), (override));
 };
 
 class TeamDelegateTest : public ::testing::Test {
@@ -30,6 +33,38 @@ protected:
     }
 };
 
+// Tests de CreateTeams
+
+// Validar que los ids vuelven en orden y que los duplicados (en la base o en la misma peticion) se reportan por equipo
+TEST_F(TeamDelegateTest, CreateTeams_DuplicatesPerItem) {
+  std::vector<domain::Team> teams = {{"", "Lobos"}, {"", "Osos"}, {"", "Lobos"}, {"", "Halcones"}};
+  std::vector<domain::Team> inserted;
+  EXPECT_CALL(*mockRepository, CreateMany(testing::_))
+    .WillOnce(testing::DoAll(testing::SaveArg<0>(&inserted),
+                             testing::Return(std::vector<std::optional<std::string>>{"id-lobos", std::nullopt, "id-halcones"})));
+
+  auto result = teamDelegate->CreateTeams(teams);
+
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(3, inserted.size());
+  EXPECT_EQ("Halcones", inserted[2].Name);
+  ASSERT_EQ(4, result->size());
+  EXPECT_EQ("id-lobos", (*result)[0].value());
+  EXPECT_EQ(Error::DUPLICATE, (*result)[1].error());
+  EXPECT_EQ(Error::DUPLICATE, (*result)[2].error());
+  EXPECT_EQ("id-halcones", (*result)[3].value());
+}
+
+// Validar que un equipo invalido rechaza el lote completo sin tocar la base
+TEST_F(TeamDelegateTest, CreateTeams_InvalidTeam) {
+  EXPECT_CALL(*mockRepository, CreateMany(testing::_)).Times(0);
+
+  auto result = teamDelegate->CreateTeams({{"", "Lobos"}, {"", ""}});
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(Error::INVALID_FORMAT, result.error());
+}
+
 // Tests de CreateTeam
 
 // Validar creacion exitosa: transferencia de valor y retorno de ID generado
@@ -100,19 +135,19 @@ TEST_F(TeamDelegateTest, GetTeam_NotFound) {
 
 // Validar lista con objetos
 TEST_F(TeamDelegateTest, GetAllTeams_Ok) {
-  std::vector<std::shared_ptr<domain::Team>> teams;
+  std::vector<domain::Team> teams;
   
-  auto team1 = std::make_shared<domain::Team>();
-  team1->Id = "550e8400-e29b-41d4-a716-446655440001";
-  team1->Name = "Team One";
+  domain::Team team1;
+  team1.Id = "550e8400-e29b-41d4-a716-446655440001";
+  team1.Name = "Team One";
   
-  auto team2 = std::make_shared<domain::Team>();
-  team2->Id = "550e8400-e29b-41d4-a716-446655440002";
-  team2->Name = "Team Two";
+  domain::Team team2;
+  team2.Id = "550e8400-e29b-41d4-a716-446655440002";
+  team2.Name = "Team Two";
   
-  auto team3 = std::make_shared<domain::Team>();
-  team3->Id = "550e8400-e29b-41d4-a716-446655440003";
-  team3->Name = "Team Three";
+  domain::Team team3;
+  team3.Id = "550e8400-e29b-41d4-a716-446655440003";
+  team3.Name = "Team Three";
   
   teams.push_back(team1);
   teams.push_back(team2);
@@ -126,17 +161,17 @@ TEST_F(TeamDelegateTest, GetAllTeams_Ok) {
   ASSERT_TRUE(result.has_value());
   auto retrievedTeams = result.value();
   ASSERT_EQ(retrievedTeams.size(), 3);
-  EXPECT_EQ(retrievedTeams[0]->Id, "550e8400-e29b-41d4-a716-446655440001");
-  EXPECT_EQ(retrievedTeams[0]->Name, "Team One");
-  EXPECT_EQ(retrievedTeams[1]->Id, "550e8400-e29b-41d4-a716-446655440002");
-  EXPECT_EQ(retrievedTeams[1]->Name, "Team Two");
-  EXPECT_EQ(retrievedTeams[2]->Id, "550e8400-e29b-41d4-a716-446655440003");
-  EXPECT_EQ(retrievedTeams[2]->Name, "Team Three");
+  EXPECT_EQ(retrievedTeams[0].Id, "550e8400-e29b-41d4-a716-446655440001");
+  EXPECT_EQ(retrievedTeams[0].Name, "Team One");
+  EXPECT_EQ(retrievedTeams[1].Id, "550e8400-e29b-41d4-a716-446655440002");
+  EXPECT_EQ(retrievedTeams[1].Name, "Team Two");
+  EXPECT_EQ(retrievedTeams[2].Id, "550e8400-e29b-41d4-a716-446655440003");
+  EXPECT_EQ(retrievedTeams[2].Name, "Team Three");
 }
 
 // Validar lista vacia
 TEST_F(TeamDelegateTest, GetAllTeams_Empty) {
-  std::vector<std::shared_ptr<domain::Team>> emptyTeams;
+  std::vector<domain::Team> emptyTeams;
 
   EXPECT_CALL(*mockRepository, ReadAll())
     .WillOnce(testing::Return(emptyTeams));
@@ -16,7 +16,7 @@ public:
     MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
 };
 
 class TournamentDelegateTest : public ::testing::Test {
@@ -95,16 +95,16 @@ TEST_F(TournamentDelegateTest, GetTournament_NotFound) {
 
 // Validar lista con objetos
 TEST_F(TournamentDelegateTest, ReadAll_Ok) {
-  std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+  std::vector<domain::Tournament> tournaments;
   
-  auto tournament1 = std::make_shared<domain::Tournament>("Tournament One");
-  tournament1->Id() = "550e8400-e29b-41d4-a716-446655440001";
+  domain::Tournament tournament1("Tournament One");
+  tournament1.Id() = "550e8400-e29b-41d4-a716-446655440001";
   
-  auto tournament2 = std::make_shared<domain::Tournament>("Tournament Two");
-  tournament2->Id() = "550e8400-e29b-41d4-a716-446655440002";
+  domain::Tournament tournament2("Tournament Two");
+  tournament2.Id() = "550e8400-e29b-41d4-a716-446655440002";
   
-  auto tournament3 = std::make_shared<domain::Tournament>("Tournament Three");
-  tournament3->Id() = "550e8400-e29b-41d4-a716-446655440003";
+  domain::Tournament tournament3("Tournament Three");
+  tournament3.Id() = "550e8400-e29b-41d4-a716-446655440003";
   
   tournaments.push_back(tournament1);
   tournaments.push_back(tournament2);
@@ -118,17 +118,17 @@ TEST_F(TournamentDelegateTest, ReadAll_Ok) {
   ASSERT_TRUE(result.has_value());
   auto retrievedTournaments = result.value();
   ASSERT_EQ(retrievedTournaments.size(), 3);
-  EXPECT_EQ(retrievedTournaments[0]->Id(), "550e8400-e29b-41d4-a716-446655440001");
-  EXPECT_EQ(retrievedTournaments[0]->Name(), "Tournament One");
-  EXPECT_EQ(retrievedTournaments[1]->Id(), "550e8400-e29b-41d4-a716-446655440002");
-  EXPECT_EQ(retrievedTournaments[1]->Name(), "Tournament Two");
-  EXPECT_EQ(retrievedTournaments[2]->Id(), "550e8400-e29b-41d4-a716-446655440003");
-  EXPECT_EQ(retrievedTournaments[2]->Name(), "Tournament Three");
+  EXPECT_EQ(retrievedTournaments[0].Id(), "550e8400-e29b-41d4-a716-446655440001");
+  EXPECT_EQ(retrievedTournaments[0].Name(), "Tournament One");
+  EXPECT_EQ(retrievedTournaments[1].Id(), "550e8400-e29b-41d4-a716-446655440002");
+  EXPECT_EQ(retrievedTournaments[1].Name(), "Tournament Two");
+  EXPECT_EQ(retrievedTournaments[2].Id(), "550e8400-e29b-41d4-a716-446655440003");
+  EXPECT_EQ(retrievedTournaments[2].Name(), "Tournament Three");
 }
 
 // Validar lista vacia
 TEST_F(TournamentDelegateTest, ReadAll_Empty) {
-  std::vector<std::shared_ptr<domain::Tournament>> emptyTournaments;
+  std::vector<domain::Tournament> emptyTournaments;
 
   EXPECT_CALL(*mockRepository, ReadAll())
     .WillOnce(testing::Return(emptyTournaments));
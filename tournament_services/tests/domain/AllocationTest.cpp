@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <expected>
+#include <nlohmann/json.hpp>
+
+#include "support/AllocationCounter.hpp"
+#include "domain/Match.hpp"
+#include "domain/Group.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
+#include "delegate/BracketGenerator.hpp"
+#include "delegate/MatchDelegate.hpp"
+#include "persistence/repository/IMatchRepository.hpp"
+#include "persistence/repository/TournamentRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "cms/IQueueMessageProducer.hpp"
+
+namespace {
+    const std::string TOURNAMENT_ID = "550e8400-e29b-41d4-a716-446655440000";
+
+    std::string MakeId(int value, std::string_view suffix) {
+        std::string id = std::to_string(value);
+        id.insert(0, 8 - id.size(), '0');
+        return id.append(suffix);
+    }
+
+    std::vector<domain::Team> CreateTeams() {
+        std::vector<domain::Team> teams;
+        for (int i = 0; i < 32; ++i) {
+            teams.push_back(domain::Team{MakeId(i, "-0000-0000-0000-000000000000"), "Team " + std::to_string(i)});
+        }
+        return teams;
+    }
+
+    // Repositorio en memoria: devuelve siempre los mismos objetos para no contar asignaciones propias del mock
+    class InMemoryMatchRepository : public IMatchRepository {
+    public:
+        std::unordered_map<std::string, std::shared_ptr<domain::Match>> byId;
+        std::unordered_map<std::string, std::shared_ptr<domain::Match>> byName;
+        int updates = 0;
+
+        explicit InMemoryMatchRepository(const std::vector<domain::Match>& matches) {
+            int next = 0;
+            for (const auto& match : matches) {
+                auto stored = std::make_shared<domain::Match>(match);
+                stored->Id() = MakeId(next++, "-1111-1111-1111-111111111111");
+                byId[stored->Id()] = stored;
+                byName[stored->Name()] = stored;
+            }
+        }
+
+        std::pmr::vector<domain::Match> FindByTournamentId(const std::string_view&, const serialization::FieldSet<domain::Match>&) override { return {}; }
+        std::shared_ptr<domain::Match> FindByTournamentIdAndMatchId(const std::string_view&, const std::string_view& matchId) override {
+            const auto it = byId.find(std::string(matchId));
+            return it == byId.end() ? nullptr : it->second;
+        }
+        std::shared_ptr<domain::Match> FindByTournamentIdAndName(const std::string_view&, const std::string_view& name) override {
+            const auto it = byName.find(std::string(name));
+            return it == byName.end() ? nullptr : it->second;
+        }
+        void UpdateMatchScore(const std::string_view&, const domain::Score&) override { ++updates; }
+        std::vector<std::string> UpdateMatchScores(const std::vector<domain::Match>&) override { ++updates; return {}; }
+        void Update(const std::string_view&, const domain::Match&) override { ++updates; }
+        std::vector<std::string> CreateBulk(const std::vector<domain::Match>&) override { return {}; }
+        bool MatchesExistForTournament(const std::string_view&) override { return true; }
+        std::string FindByTournamentIdAsJson(const std::string_view&, const serialization::FieldSet<domain::Match>&) override { return "[]"; }
+        std::optional<std::string> FindVersionByTournamentId(const std::string_view&) override { return "0-0"; }
+        std::optional<std::pmr::vector<domain::BracketMatch>> FindBracketByTournamentId(const std::string_view&) override { return std::nullopt; }
+    };
+
+    struct NullQueueMessageProducer : public IQueueMessageProducer {
+        int messages = 0;
+        void SendMessage(const std::string_view&, const std::string_view&) override { ++messages; }
+    };
+
+    struct DummyConnectionProvider : public IDbConnectionProvider {
+        PooledConnection Connection() override {
+            return PooledConnection(nullptr, [](IDbConnection*){});
+        }
+    };
+}
+
+// Validar que los getters const no copian strings ni vectores
+TEST(AllocationTest, ConstAccessors_NoAllocations) {
+    domain::Match match;
+    match.Id() = "660e8400-e29b-41d4-a716-446655440001-with-a-long-suffix";
+    match.Name() = "W0";
+    match.TournamentId() = TOURNAMENT_ID;
+    match.HomeTeamId() = TOURNAMENT_ID;
+    match.VisitorTeamId() = TOURNAMENT_ID;
+
+    domain::Group group{"Group with a name long enough to avoid SSO", TOURNAMENT_ID};
+    group.TournamentId() = TOURNAMENT_ID;
+    group.Teams() = CreateTeams();
+
+    domain::Tournament tournament{"Tournament with a name long enough to avoid SSO"};
+    tournament.Id() = TOURNAMENT_ID;
+    tournament.Matches() = BracketGenerator().GenerateMatches(TOURNAMENT_ID, CreateTeams());
+
+    const auto& constMatch = match;
+    const auto& constGroup = group;
+    const auto& constTournament = tournament;
+
+    std::size_t total = 0;
+    const auto stats = test_support::CountAllocations([&] {
+        total += constMatch.Id().size() + constMatch.Name().size() + constMatch.TournamentId().size();
+        total += constMatch.HomeTeamId().size() + constMatch.VisitorTeamId().size();
+        total += static_cast<std::size_t>(constMatch.MatchScore().homeTeamScore);
+        total += constGroup.Id().size() + constGroup.Name().size() + constGroup.TournamentId().size() + constGroup.Teams().size();
+        total += constTournament.Id().size() + constTournament.Name().size();
+        total += static_cast<std::size_t>(constTournament.Format().MaxTeamsPerGroup());
+        total += constTournament.Matches().size() + constTournament.Groups().size();
+    });
+
+    EXPECT_GT(total, 0u);
+    EXPECT_EQ(0u, stats.allocations);
+}
+
+// Validar el presupuesto de asignaciones al serializar los 63 matches de un torneo
+TEST(AllocationTest, SerializeMatches_WithinBudget) {
+    const std::vector<domain::Match> matches = BracketGenerator().GenerateMatches(TOURNAMENT_ID, CreateTeams());
+    ASSERT_EQ(63u, matches.size());
+
+    std::string body;
+    const auto stats = test_support::CountAllocations([&] {
+        nlohmann::json json = matches;
+        body = json.dump();
+    });
+
+    EXPECT_FALSE(body.empty());
+    EXPECT_LE(stats.allocations, 2200u) << stats.allocations;
+}
+
+// Validar el presupuesto de asignaciones de una actualizacion de marcador
+TEST(AllocationTest, UpdateMatchScore_WithinBudget) {
+    auto matchRepository = std::make_shared<InMemoryMatchRepository>(
+        BracketGenerator().GenerateMatches(TOURNAMENT_ID, CreateTeams()));
+    auto tournamentRepository = std::make_shared<TournamentRepository>(std::make_shared<DummyConnectionProvider>());
+    auto messageProducer = std::make_shared<NullQueueMessageProducer>();
+    MatchDelegate matchDelegate(matchRepository, tournamentRepository, messageProducer);
+
+    domain::Match match;
+    match.Id() = matchRepository->byName.at("W0")->Id();
+    match.TournamentId() = TOURNAMENT_ID;
+    match.MatchScore().homeTeamScore = 0;
+    match.MatchScore().visitorTeamScore = 1;
+
+    std::expected<std::string, Error> result;
+    const auto stats = test_support::CountAllocations([&] {
+        result = matchDelegate.UpdateMatchScore(match);
+    });
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(1, messageProducer->messages);
+    EXPECT_LE(stats.allocations, 24u) << stats.allocations;
+}
+
+// Validar que dentro de un RequestScope los objetos se crean en el arena del hilo y no en el heap global
+TEST(AllocationTest, RequestScope_ServesFromArena) {
+    memory::RequestArena::ForThread();
+
+    std::vector<std::shared_ptr<domain::Score>> scores;
+    scores.reserve(100);
+    const auto outside = test_support::CountAllocations([&] {
+        for (int i = 0; i < 100; ++i) {
+            scores.push_back(memory::MakeShared<domain::Score>(domain::Score{i, i}));
+        }
+        scores.clear();
+    });
+
+    const auto inside = test_support::CountAllocations([&] {
+        memory::RequestScope scope;
+        for (int i = 0; i < 100; ++i) {
+            scores.push_back(memory::MakeShared<domain::Score>(domain::Score{i, i}));
+        }
+        EXPECT_EQ(99, scores.back()->homeTeamScore);
+        scores.clear();
+    });
+
+    EXPECT_EQ(100u, outside.allocations);
+    EXPECT_EQ(0u, inside.allocations);
+}
+
+// Validar que las lecturas de listas reservan sus elementos en el arena de la peticion
+TEST(AllocationTest, RequestScope_ListsFromArena) {
+    memory::RequestArena::ForThread();
+
+    const auto outside = test_support::CountAllocations([&] {
+        auto matches = memory::MakeList<domain::Match>(63);
+        matches.resize(63);
+    });
+
+    const auto inside = test_support::CountAllocations([&] {
+        memory::RequestScope scope;
+        auto matches = memory::MakeList<domain::Match>(63);
+        matches.resize(63);
+        EXPECT_EQ(memory::RequestResource(), matches.get_allocator().resource());
+    });
+
+    EXPECT_EQ(1u, outside.allocations);
+    EXPECT_EQ(0u, inside.allocations);
+}
+
+// Validar que el arena se libera al cerrar el scope y se reutiliza en la siguiente peticion
+TEST(AllocationTest, RequestScope_ReleasedOnExit) {
+    const domain::Score* first = nullptr;
+    {
+        memory::RequestScope scope;
+        first = memory::MakeShared<domain::Score>().get();
+        {
+            memory::RequestScope nested;
+        }
+        EXPECT_NE(std::pmr::get_default_resource(), memory::RequestResource());
+    }
+    EXPECT_EQ(std::pmr::get_default_resource(), memory::RequestResource());
+
+    memory::RequestScope scope;
+    EXPECT_EQ(first, memory::MakeShared<domain::Score>().get());
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "domain/Uuid.hpp"
+
+static_assert(domain::IsValidId("550e8400-e29b-41d4-a716-446655440000"));
+static_assert(!domain::IsValidId("550e8400e29b41d4a716446655440000"));
+
+// Validar ids bien formados, en minusculas y mayusculas
+TEST(UuidTest, IsValidId_Ok) {
+    EXPECT_TRUE(domain::IsValidId("550e8400-e29b-41d4-a716-446655440000"));
+    EXPECT_TRUE(domain::IsValidId("550E8400-E29B-41D4-A716-446655440000"));
+    EXPECT_TRUE(domain::IsValidId("00000000-0000-0000-0000-000000000000"));
+    EXPECT_TRUE(domain::IsValidId("ffffffff-FFFF-aaaa-AAAA-0123456789ab"));
+}
+
+// Validar rechazo de ids con formato invalido
+TEST(UuidTest, IsValidId_Invalid) {
+    EXPECT_FALSE(domain::IsValidId(""));
+    EXPECT_FALSE(domain::IsValidId("invalid-id"));
+    EXPECT_FALSE(domain::IsValidId("550e8400-e29b-41d4-a716-44665544000"));
+    EXPECT_FALSE(domain::IsValidId("550e8400-e29b-41d4-a716-4466554400000"));
+    EXPECT_FALSE(domain::IsValidId("550e8400-e29b-41d4-a716_446655440000"));
+    EXPECT_FALSE(domain::IsValidId("550e8400-e29b-41d4-a716-44665544000g"));
+    EXPECT_FALSE(domain::IsValidId("g50e8400-e29b-41d4-a716-446655440000"));
+    EXPECT_FALSE(domain::IsValidId("550e8400-e29b-41d4-a71-6446655440000"));
+    EXPECT_FALSE(domain::IsValidId("{50e8400-e29b-41d4-a716-446655440000"));
+    EXPECT_FALSE(domain::IsValidId(std::string("550e8400-e29b-41d4-a716-\xe9""46655440000")));
+}
+
+// Validar que la ruta escalar y la vectorizada coinciden con la expresion regular original
+TEST(UuidTest, IsValidId_MatchesRegex) {
+    const std::regex idValue(R"(^[0-9a-fA-F]{8}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{12}$)");
+    const std::string base = "550e8400-e29b-41d4-a716-446655440000";
+    const std::vector<char> replacements = {'0', '9', 'a', 'f', 'A', 'F', 'g', 'G', '-', '/', ':', '@', '`', ' ', '\x80', '\xff'};
+
+    for (std::size_t position = 0; position < base.size(); ++position) {
+        for (const char replacement : replacements) {
+            std::string candidate = base;
+            candidate[position] = replacement;
+            const bool expected = std::regex_match(candidate, idValue);
+            EXPECT_EQ(expected, domain::uuid::IsValidScalar(candidate)) << candidate;
+            EXPECT_EQ(expected, domain::IsValidId(candidate)) << candidate;
+        }
+    }
+}
+
+// Validar que el id canonico es el texto en minusculas que devuelve Postgres
+TEST(UuidTest, CanonicalId_Lowercase) {
+    EXPECT_EQ("550e8400-e29b-41d4-a716-446655440000", domain::CanonicalId("550E8400-E29B-41d4-A716-446655440000"));
+    EXPECT_EQ("550e8400-e29b-41d4-a716-446655440000", domain::CanonicalId("550e8400-e29b-41d4-a716-446655440000"));
+}
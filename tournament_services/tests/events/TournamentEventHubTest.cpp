@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "events/TournamentEventHub.hpp"
+
+namespace {
+    using std::chrono::minutes;
+    using std::chrono::steady_clock;
+
+    const std::string TOURNAMENT = "12345678-1234-1234-1234-123456789abc";
+    const std::string OTHER = "87654321-4321-4321-4321-cba987654321";
+}
+
+// Validar que solo se guardan cambios de torneos con espectadores y que cada lector recibe lo posterior a su id
+TEST(TournamentEventHubTest, PublishesOnlyToOpenChannels) {
+    events::TournamentEventHub hub;
+    const auto now = steady_clock::now();
+    hub.Publish(TOURNAMENT, "match", "{}");
+    EXPECT_FALSE(hub.Since(TOURNAMENT, std::nullopt, now).has_value());
+
+    hub.Open(TOURNAMENT, now);
+    const auto start = hub.Since(TOURNAMENT, std::nullopt, now);
+    ASSERT_TRUE(start.has_value());
+    EXPECT_TRUE(start->events.empty());
+
+    events::PublishMatchChange(hub, R"({"tournamentId": ")" + TOURNAMENT + R"(", "match": {"id": "m1", "name": "W0"}})");
+    events::PublishMatchChange(hub, R"({"tournamentId": ")" + OTHER + R"(", "match": {"id": "m9"}})");
+    events::PublishMatchChange(hub, "no es json");
+    events::PublishMatchChange(hub, R"({"tournamentId": ")" + TOURNAMENT + R"(", "match": {"id": "m2", "name": "W1"}})");
+
+    const auto all = hub.Since(TOURNAMENT, start->lastId, now);
+    ASSERT_EQ(2, all->events.size());
+    EXPECT_EQ("match", all->events[0].type);
+    EXPECT_EQ(R"({"id":"m1","name":"W0"})", all->events[0].data);
+    EXPECT_FALSE(all->reset);
+
+    const auto rest = hub.Since(TOURNAMENT, all->events[0].id, now);
+    ASSERT_EQ(1, rest->events.size());
+    EXPECT_EQ(R"({"id":"m2","name":"W1"})", rest->events[0].data);
+    EXPECT_EQ(1, hub.OpenChannels());
+}
+
+// Validar que un lector atrasado mas alla del buffer recibe reset
+TEST(TournamentEventHubTest, OverrunAndResetAllRequestReload) {
+    events::TournamentEventHub hub;
+    const auto now = steady_clock::now();
+    hub.Open(TOURNAMENT, now);
+    const auto start = hub.Since(TOURNAMENT, std::nullopt, now)->lastId;
+
+    for (std::size_t i = 0; i < events::TournamentEventHub::BUFFER_SIZE + 1; ++i) {
+        hub.Publish(TOURNAMENT, "match", "{}");
+    }
+    EXPECT_TRUE(hub.Since(TOURNAMENT, start, now)->reset);
+    const auto current = hub.Since(TOURNAMENT, start + 1, now);
+    EXPECT_FALSE(current->reset);
+    EXPECT_EQ(events::TournamentEventHub::BUFFER_SIZE, current->events.size());
+
+    hub.ResetAll();
+    EXPECT_TRUE(hub.Since(TOURNAMENT, current->lastId - 1, now)->reset);
+    EXPECT_FALSE(hub.Since(TOURNAMENT, current->lastId, now)->reset);
+}
+
+// Validar que los canales sin lectores se cierran
+TEST(TournamentEventHubTest, IdleChannelsExpire) {
+    events::TournamentEventHub hub;
+    const auto now = steady_clock::now();
+    hub.Open(TOURNAMENT, now);
+    hub.Open(OTHER, now);
+    hub.Since(OTHER, std::nullopt, now + minutes(2));
+
+    hub.Expire(now + minutes(3));
+
+    EXPECT_FALSE(hub.IsOpen(TOURNAMENT));
+    EXPECT_TRUE(hub.IsOpen(OTHER));
+}
+
+// Validar que un lector sin novedades queda en espera hasta el siguiente cambio, su plazo o el cierre
+TEST(TournamentEventHubTest, AwaitParksUntilPublishOrDeadline) {
+    events::TournamentEventHub hub;
+    const auto now = steady_clock::now();
+    EXPECT_FALSE(hub.Await(TOURNAMENT, std::nullopt, now, now + minutes(1), [](const events::Backlog&) {
+        ADD_FAILURE() << "closed channel delivered";
+    }));
+    hub.Open(TOURNAMENT, now);
+
+    std::vector<events::Backlog> delivered;
+    const auto record = [&delivered](const events::Backlog& backlog) { delivered.push_back(backlog); };
+    EXPECT_TRUE(hub.Await(TOURNAMENT, std::nullopt, now, now + minutes(1), record));
+    EXPECT_TRUE(hub.Await(TOURNAMENT, std::nullopt, now, now + minutes(5), record));
+    EXPECT_TRUE(delivered.empty());
+
+    hub.Publish(TOURNAMENT, "match", R"({"id":"m1"})");
+    ASSERT_EQ(2, delivered.size());
+    ASSERT_EQ(1, delivered[0].events.size());
+    EXPECT_EQ(R"({"id":"m1"})", delivered[1].events[0].data);
+
+    // ya hay algo despues del id: se entrega de inmediato
+    EXPECT_TRUE(hub.Await(TOURNAMENT, 0, now, now + minutes(1), record));
+    EXPECT_EQ(3, delivered.size());
+
+    EXPECT_TRUE(hub.Await(TOURNAMENT, delivered[0].lastId, now, now + minutes(1), record));
+    EXPECT_TRUE(hub.Await(TOURNAMENT, delivered[0].lastId, now, now + minutes(5), record));
+    hub.Expire(now + minutes(3));
+    ASSERT_EQ(4, delivered.size());
+    EXPECT_TRUE(delivered[3].events.empty());
+    EXPECT_EQ(1, delivered[3].lastId);
+    // un lector en espera mantiene el canal abierto
+    EXPECT_TRUE(hub.IsOpen(TOURNAMENT));
+
+    hub.ReleaseAll();
+    EXPECT_EQ(5, delivered.size());
+    EXPECT_TRUE(hub.Await(TOURNAMENT, delivered[0].lastId, now, now + minutes(1), record));
+    EXPECT_EQ(6, delivered.size());
+    EXPECT_EQ(0, hub.Waiting());
+}
+
+// Validar el formato text/event-stream
+TEST(TournamentEventHubTest, RenderEventStream) {
+    events::Backlog backlog;
+    backlog.events.push_back({7, "match", R"({"id":"m1"})"});
+    backlog.lastId = 9;
+
+    EXPECT_EQ("retry: 2000\n\nid: 7\nevent: match\ndata: {\"id\":\"m1\"}\n\nid: 9\n\n",
+              events::RenderEventStream(backlog, std::chrono::milliseconds(2000)));
+
+    events::Backlog reset;
+    reset.reset = true;
+    reset.lastId = 3;
+    EXPECT_EQ("retry: 1000\n\nevent: reset\ndata: {}\n\nid: 3\n\n",
+              events::RenderEventStream(reset, std::chrono::milliseconds(1000)));
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <crow.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+
+#include "controller/HealthController.hpp"
+#include "health/HealthMonitor.hpp"
+
+namespace {
+  constexpr auto INTERVAL = std::chrono::milliseconds(100);
+}
+
+// Validar que sin una ronda de chequeos completa la instancia no esta lista. Response 503
+TEST(HealthMonitorTest, NotReadyBeforeFirstCheck) {
+  auto monitor = std::make_shared<health::HealthMonitor>(std::vector<health::Check>{{"database", [] { return true; }}}, INTERVAL);
+  HealthController controller(monitor);
+
+  EXPECT_EQ(crow::OK, controller.GetLive().code);
+  EXPECT_EQ(crow::SERVICE_UNAVAILABLE, controller.GetReady().code);
+}
+
+// Validar que una dependencia caida o que lanza excepcion marca la instancia como no lista. Response 200 y 503
+TEST(HealthMonitorTest, ReadyFollowsDependencies) {
+  std::atomic<bool> brokerUp = true;
+  auto monitor = std::make_shared<health::HealthMonitor>(std::vector<health::Check>{
+    {"database", [] { return true; }},
+    {"broker", [&] { if (!brokerUp) throw std::runtime_error("down"); return true; }},
+  }, INTERVAL);
+  HealthController controller(monitor);
+
+  monitor->CheckNow();
+  crow::response ready = controller.GetReady();
+  EXPECT_EQ(crow::OK, ready.code);
+  EXPECT_EQ("ready", nlohmann::json::parse(ready.body)["status"]);
+
+  brokerUp = false;
+  monitor->CheckNow();
+  crow::response unavailable = controller.GetReady();
+  EXPECT_EQ(crow::SERVICE_UNAVAILABLE, unavailable.code);
+  const auto body = nlohmann::json::parse(unavailable.body);
+  EXPECT_EQ("unavailable", body["status"]);
+  EXPECT_EQ("up", body["dependencies"]["database"]);
+  EXPECT_EQ("down", body["dependencies"]["broker"]);
+}
+
+// Validar que un resultado viejo deja de contar como listo
+TEST(HealthMonitorTest, StaleResultIsNotReady) {
+  health::HealthMonitor monitor({{"database", [] { return true; }}}, INTERVAL);
+  monitor.CheckNow();
+  const auto now = std::chrono::steady_clock::now();
+
+  EXPECT_TRUE(monitor.Current(now).ready);
+  EXPECT_FALSE(monitor.Current(now + INTERVAL * (health::HealthMonitor::STALE_AFTER + 1)).ready);
+}
+
+// Validar que al drenar la instancia deja de estar lista aunque las dependencias esten bien. Response 503
+TEST(HealthMonitorTest, DrainingFlipsReadiness) {
+  auto monitor = std::make_shared<health::HealthMonitor>(std::vector<health::Check>{{"database", [] { return true; }}}, INTERVAL);
+  HealthController controller(monitor);
+  monitor->CheckNow();
+
+  monitor->BeginDraining();
+
+  crow::response response = controller.GetReady();
+  EXPECT_EQ(crow::SERVICE_UNAVAILABLE, response.code);
+  EXPECT_EQ("draining", nlohmann::json::parse(response.body)["status"]);
+  EXPECT_EQ(crow::OK, controller.GetLive().code);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <crow.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "metrics/Metrics.hpp"
+
+namespace {
+    struct FakePool : public IDbConnectionProvider {
+        PooledConnection Connection() override {
+            return PooledConnection(nullptr, [](IDbConnection*) {});
+        }
+
+        PoolStatistics Statistics() override {
+            return {2, 1, 3, std::chrono::microseconds(1500)};
+        }
+    };
+
+    bool Contains(const std::string& text, const std::string& line) {
+        return text.find(line + "\n") != std::string::npos;
+    }
+}
+
+// Validar que la latencia y el codigo de estado quedan bajo la plantilla de la ruta
+TEST(MetricsTest, ObserveRoute_RecordsLatencyAndStatus) {
+    auto& registry = metrics::Registry::Instance();
+    const auto route = registry.RegisterRoute("GET", "/test/<string>/observe");
+
+    auto ok = metrics::ObserveRoute(route, [] { return crow::response{crow::OK}; });
+    auto missing = metrics::ObserveRoute(route, [] { return crow::response{crow::NOT_FOUND}; });
+    EXPECT_EQ(crow::OK, ok.code);
+    EXPECT_EQ(crow::NOT_FOUND, missing.code);
+
+    const std::string text = registry.Render(nullptr);
+    const std::string labels = R"(method="GET",route="/test/<string>/observe")";
+    EXPECT_TRUE(Contains(text, "http_responses_total{" + labels + R"(,status="200"} 1)"));
+    EXPECT_TRUE(Contains(text, "http_responses_total{" + labels + R"(,status="404"} 1)"));
+    EXPECT_TRUE(Contains(text, "http_request_duration_seconds_bucket{" + labels + R"(,le="+Inf"} 2)"));
+    EXPECT_TRUE(Contains(text, "http_request_duration_seconds_count{" + labels + "} 2"));
+}
+
+// Validar que un handler que lanza excepcion cuenta como 500 y no deja la peticion en vuelo
+TEST(MetricsTest, ObserveRoute_ExceptionCountsAs500) {
+    auto& registry = metrics::Registry::Instance();
+    const auto route = registry.RegisterRoute("PATCH", "/test/throws");
+
+    EXPECT_THROW(metrics::ObserveRoute(route, []() -> crow::response { throw std::runtime_error("db"); }), std::runtime_error);
+
+    const std::string text = registry.Render(nullptr);
+    EXPECT_TRUE(Contains(text, R"(http_responses_total{method="PATCH",route="/test/throws",status="500"} 1)"));
+    EXPECT_TRUE(Contains(text, "http_requests_in_flight 0"));
+}
+
+// Validar que una respuesta completada despues del handler se registra una sola vez al terminar, y como 500 si nunca termina
+TEST(MetricsTest, PendingRequest_RecordsWhenFinished) {
+    auto& registry = metrics::Registry::Instance();
+    const auto route = registry.RegisterRoute("GET", "/test/<string>/held");
+    const std::string labels = R"(method="GET",route="/test/<string>/held")";
+
+    metrics::PendingRequest held(route);
+    const auto copy = held;
+    EXPECT_FALSE(Contains(registry.Render(nullptr), "http_request_duration_seconds_count{" + labels + "}"));
+    copy.Finish(crow::OK);
+    held.Finish(crow::NOT_FOUND);
+    { metrics::PendingRequest dropped(route); }
+
+    const std::string text = registry.Render(nullptr);
+    EXPECT_TRUE(Contains(text, "http_responses_total{" + labels + R"(,status="200"} 1)"));
+    EXPECT_FALSE(Contains(text, "http_responses_total{" + labels + R"(,status="404"})"));
+    EXPECT_TRUE(Contains(text, "http_responses_total{" + labels + R"(,status="500"} 1)"));
+    EXPECT_TRUE(Contains(text, "http_request_duration_seconds_count{" + labels + "} 2"));
+}
+
+// Validar que los contadores de cada hilo se suman al renderizar
+TEST(MetricsTest, ShardsAggregateAcrossThreads) {
+    auto& registry = metrics::Registry::Instance();
+    const auto route = registry.RegisterRoute("GET", "/test/threads");
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([route] {
+            for (int i = 0; i < 250; ++i) {
+                metrics::ObserveRoute(route, [] { return crow::response{crow::OK}; });
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const std::string text = metrics::Registry::Instance().Render(nullptr);
+    EXPECT_TRUE(Contains(text, R"(http_responses_total{method="GET",route="/test/threads",status="200"} 1000)"));
+}
+
+// Validar los buckets acumulados del envio al broker y las estadisticas del pool
+TEST(MetricsTest, BrokerAndPoolSeries) {
+    auto& registry = metrics::Registry::Instance();
+    const std::string before = registry.Render(nullptr);
+    registry.ObserveBrokerSend(std::chrono::microseconds(700));
+    registry.ObserveBrokerSend(std::chrono::microseconds(20'000));
+
+    const std::string text = registry.Render(std::make_shared<FakePool>());
+    EXPECT_TRUE(Contains(text, R"(broker_send_duration_seconds_bucket{le="0.0005"} 0)"));
+    EXPECT_TRUE(Contains(text, R"(broker_send_duration_seconds_bucket{le="0.001"} 1)"));
+    EXPECT_TRUE(Contains(text, R"(broker_send_duration_seconds_bucket{le="0.025"} 2)"));
+    EXPECT_TRUE(Contains(text, "broker_send_duration_seconds_sum 0.0207"));
+    EXPECT_TRUE(Contains(text, R"(db_pool_connections{state="idle"} 1)"));
+    EXPECT_TRUE(Contains(text, R"(db_pool_connections{state="in_use"} 1)"));
+    EXPECT_TRUE(Contains(text, "db_pool_waiting 3"));
+    EXPECT_TRUE(Contains(text, "db_pool_wait_seconds 0.0015"));
+    EXPECT_EQ(std::string::npos, before.find("db_pool_waiting"));
+}
+
+// Validar el escape de valores de etiqueta segun el formato de texto de Prometheus
+TEST(MetricsTest, EscapeLabelValue) {
+    EXPECT_EQ(R"(a\\b\"c\nd)", metrics::detail::Escape("a\\b\"c\nd"));
+}
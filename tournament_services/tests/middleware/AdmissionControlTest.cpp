@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <crow.h>
+#include <memory>
+
+#include "middleware/AdmissionControl.hpp"
+
+namespace {
+    // Pool falso: solo expone la espera promedio que se le indique
+    struct FakePool : public IDbConnectionProvider {
+        std::chrono::microseconds averageWait{0};
+
+        PooledConnection Connection() override {
+            return PooledConnection(nullptr, [](IDbConnection*) {});
+        }
+
+        PoolStatistics Statistics() override {
+            return {2, 2, 0, averageWait};
+        }
+    };
+
+    using admission::RouteClass;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+}
+
+class AdmissionControlTest : public ::testing::Test {
+protected:
+    std::shared_ptr<FakePool> pool = std::make_shared<FakePool>();
+    std::shared_ptr<admission::AdmissionController> controller = std::make_shared<admission::AdmissionController>(
+        pool, admission::Budget{1, 4}, admission::Budget{1, 2}, 8, milliseconds(50));
+};
+
+// Validar que se rechaza al superar el limite y que liberar devuelve el lugar
+TEST_F(AdmissionControlTest, RejectsBeyondLimit) {
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(controller->TryAcquire(RouteClass::READ));
+    }
+    EXPECT_FALSE(controller->TryAcquire(RouteClass::READ));
+    EXPECT_EQ(4, controller->InFlight(RouteClass::READ));
+
+    controller->Release(RouteClass::READ);
+    EXPECT_TRUE(controller->TryAcquire(RouteClass::READ));
+}
+
+// Validar que las lecturas saturadas no consumen el presupuesto de escrituras
+TEST_F(AdmissionControlTest, ReadsDoNotStarveWrites) {
+    while (controller->TryAcquire(RouteClass::READ)) {}
+
+    EXPECT_TRUE(controller->TryAcquire(RouteClass::WRITE));
+    EXPECT_TRUE(controller->TryAcquire(RouteClass::WRITE));
+    EXPECT_FALSE(controller->TryAcquire(RouteClass::WRITE));
+}
+
+// Validar que las lecturas nunca ocupan los hilos reservados a escrituras, aunque su presupuesto sea mayor
+TEST_F(AdmissionControlTest, ReadsCappedBelowHandlerThreads) {
+    admission::AdmissionController threads(pool, admission::Budget{4, 64}, admission::Budget{2, 16}, 4, milliseconds(50));
+    EXPECT_EQ(2, threads.Limit(RouteClass::READ));
+    EXPECT_EQ(4, threads.Limit(RouteClass::WRITE));
+
+    while (threads.TryAcquire(RouteClass::READ)) {}
+    EXPECT_EQ(2, threads.InFlight(RouteClass::READ));
+
+    // los dos hilos restantes siguen admitiendo escrituras
+    EXPECT_TRUE(threads.TryAcquire(RouteClass::WRITE));
+    EXPECT_TRUE(threads.TryAcquire(RouteClass::WRITE));
+    EXPECT_LE(threads.InFlight(RouteClass::READ) + threads.InFlight(RouteClass::WRITE), 4);
+}
+
+// Validar que el limite baja mientras la espera del pool supera el objetivo y se recupera cuando baja
+TEST_F(AdmissionControlTest, LimitFollowsPoolWait) {
+    auto now = steady_clock::now();
+    pool->averageWait = milliseconds(200);
+    for (int i = 0; i < 10; ++i) {
+        now += milliseconds(150);
+        controller->Adapt(now);
+    }
+    EXPECT_EQ(1, controller->Limit(RouteClass::READ));
+    EXPECT_EQ(1, controller->Limit(RouteClass::WRITE));
+    EXPECT_EQ(1, controller->RetryAfterSeconds());
+
+    // dentro del mismo intervalo no se vuelve a ajustar
+    pool->averageWait = milliseconds(0);
+    controller->Adapt(now + milliseconds(10));
+    EXPECT_EQ(1, controller->Limit(RouteClass::READ));
+
+    for (int i = 0; i < 10; ++i) {
+        now += milliseconds(150);
+        controller->Adapt(now);
+    }
+    EXPECT_EQ(4, controller->Limit(RouteClass::READ));
+    EXPECT_EQ(2, controller->Limit(RouteClass::WRITE));
+}
+
+// Validar que el middleware responde 503 con Retry-After sin liberar un lugar que no tomo
+TEST_F(AdmissionControlTest, Middleware_RejectsWithRetryAfter) {
+    AdmissionMiddleware middleware;
+    middleware.controller = controller;
+
+    crow::request write;
+    write.method = crow::HTTPMethod::Patch;
+    write.url = "/tournaments/t1/matches/m1";
+
+    AdmissionMiddleware::context first;
+    AdmissionMiddleware::context second;
+    AdmissionMiddleware::context third;
+    crow::response admitted1;
+    crow::response admitted2;
+    crow::response rejected;
+    middleware.before_handle(write, admitted1, first);
+    middleware.before_handle(write, admitted2, second);
+    middleware.before_handle(write, rejected, third);
+
+    EXPECT_FALSE(admitted1.completed);
+    EXPECT_EQ(crow::SERVICE_UNAVAILABLE, rejected.code);
+    EXPECT_TRUE(rejected.completed);
+    EXPECT_EQ("1", rejected.get_header_value("Retry-After"));
+
+    middleware.after_handle(write, rejected, third);
+    EXPECT_EQ(2, controller->InFlight(RouteClass::WRITE));
+    middleware.after_handle(write, admitted1, first);
+    middleware.after_handle(write, admitted2, second);
+    EXPECT_EQ(0, controller->InFlight(RouteClass::WRITE));
+}
+
+// Validar que las rutas de health y los streams de eventos nunca se rechazan ni ocupan lugar
+TEST_F(AdmissionControlTest, Middleware_HealthExempt) {
+    AdmissionMiddleware middleware;
+    middleware.controller = controller;
+    while (controller->TryAcquire(RouteClass::READ)) {}
+
+    crow::request health;
+    health.url = "/health";
+    crow::response response;
+    AdmissionMiddleware::context context;
+    middleware.before_handle(health, response, context);
+
+    EXPECT_FALSE(response.completed);
+    EXPECT_EQ(crow::OK, response.code);
+
+    crow::request stream;
+    stream.method = crow::HTTPMethod::Get;
+    stream.url = "/tournaments/t1/events";
+    crow::response held;
+    AdmissionMiddleware::context streamContext;
+    middleware.before_handle(stream, held, streamContext);
+
+    EXPECT_FALSE(held.completed);
+    EXPECT_FALSE(streamContext.admitted.has_value());
+}
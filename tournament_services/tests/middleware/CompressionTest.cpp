@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <crow.h>
+#include <string>
+#include <zlib.h>
+
+#include "middleware/Compression.hpp"
+
+namespace {
+    // Descomprime gzip o deflate (zlib) detectando el formato por la cabecera
+    std::string Inflate(const std::string& compressed) {
+        z_stream stream{};
+        inflateInit2(&stream, 15 + 32);
+        std::string output(64 * 1024, '\0');
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+        stream.avail_in = static_cast<uInt>(compressed.size());
+        stream.next_out = reinterpret_cast<Bytef*>(output.data());
+        stream.avail_out = static_cast<uInt>(output.size());
+        const int status = inflate(&stream, Z_FINISH);
+        output.resize(stream.total_out);
+        inflateEnd(&stream);
+        return status == Z_STREAM_END ? output : std::string{};
+    }
+
+    std::string LargeBody() {
+        std::string body = "[";
+        for (int i = 0; i < 63; ++i) {
+            body += R"({"id":"match-)" + std::to_string(i) + R"(","score":{"homeTeamScore":0,"visitorTeamScore":0}},)";
+        }
+        body.back() = ']';
+        return body;
+    }
+}
+
+// Validar la negociacion de Accept-Encoding: preferencia por q, gzip en empate y q=0 excluye
+TEST(CompressionTest, Negotiate) {
+    using compression::Coding;
+    EXPECT_EQ(Coding::GZIP, compression::Negotiate("gzip, deflate, br"));
+    EXPECT_EQ(Coding::DEFLATE, compression::Negotiate("gzip;q=0.5, deflate"));
+    EXPECT_EQ(Coding::DEFLATE, compression::Negotiate("deflate"));
+    EXPECT_EQ(Coding::GZIP, compression::Negotiate("*"));
+    EXPECT_EQ(Coding::DEFLATE, compression::Negotiate("gzip;q=0, *"));
+    EXPECT_EQ(Coding::IDENTITY, compression::Negotiate("br, identity"));
+    EXPECT_EQ(Coding::IDENTITY, compression::Negotiate(""));
+}
+
+// Validar que una respuesta grande se comprime con gzip y se puede recuperar
+TEST(CompressionTest, CompressResponse_Gzip) {
+    crow::request request;
+    request.add_header("Accept-Encoding", "gzip");
+    crow::response response{crow::OK, LargeBody()};
+    response.add_header("vary", "Accept");
+    response.add_header("etag", "\"63-1-json\"");
+
+    compression::CompressResponse(request, response);
+
+    EXPECT_EQ("gzip", response.get_header_value("content-encoding"));
+    EXPECT_EQ("Accept, Accept-Encoding", response.get_header_value("vary"));
+    EXPECT_EQ("\"63-1-json-gzip\"", response.get_header_value("etag"));
+    EXPECT_LT(response.body.size(), LargeBody().size());
+    EXPECT_EQ(LargeBody(), Inflate(response.body));
+}
+
+// Validar que el contexto por hilo se reutiliza entre respuestas y con deflate
+TEST(CompressionTest, CompressResponse_DeflateReusesContext) {
+    crow::request request;
+    request.add_header("Accept-Encoding", "deflate");
+    for (int i = 0; i < 3; ++i) {
+        crow::response response{crow::OK, LargeBody()};
+        compression::CompressResponse(request, response);
+
+        EXPECT_EQ("deflate", response.get_header_value("content-encoding"));
+        EXPECT_EQ(LargeBody(), Inflate(response.body));
+    }
+}
+
+// Validar que los cuerpos pequenos, los ya codificados y los clientes sin Accept-Encoding no se tocan
+TEST(CompressionTest, CompressResponse_Skipped) {
+    crow::request gzipRequest;
+    gzipRequest.add_header("Accept-Encoding", "gzip");
+
+    crow::response small{crow::OK, R"({"id":"1"})"};
+    compression::CompressResponse(gzipRequest, small);
+    EXPECT_TRUE(small.get_header_value("content-encoding").empty());
+    EXPECT_EQ(R"({"id":"1"})", small.body);
+
+    crow::response encoded{crow::OK, LargeBody()};
+    encoded.add_header("content-encoding", "gzip");
+    compression::CompressResponse(gzipRequest, encoded);
+    EXPECT_EQ(LargeBody(), encoded.body);
+
+    crow::response identity{crow::OK, LargeBody()};
+    compression::CompressResponse(crow::request{}, identity);
+    EXPECT_TRUE(identity.get_header_value("content-encoding").empty());
+    EXPECT_EQ(LargeBody(), identity.body);
+    EXPECT_EQ("Accept-Encoding", identity.get_header_value("vary"));
+}
+
+// Validar que el sufijo de codificacion del ETag se agrega y se quita de forma simetrica
+TEST(CompressionTest, TagFor_UncodedTag) {
+    EXPECT_EQ("\"v-json-gzip\"", compression::TagFor("\"v-json\"", "gzip"));
+    EXPECT_EQ("\"v-json\"", compression::UncodedTag("\"v-json-gzip\""));
+    EXPECT_EQ("\"v-json\"", compression::UncodedTag("\"v-json-deflate\""));
+    EXPECT_EQ("\"v-json\"", compression::UncodedTag("\"v-json\""));
+}
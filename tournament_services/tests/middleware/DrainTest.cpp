@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <crow.h>
+#include <memory>
+#include <thread>
+
+#include "middleware/Drain.hpp"
+
+namespace {
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+}
+
+// Validar que el middleware cuenta las solicitudes en curso
+TEST(DrainTest, TracksRequestsInFlight) {
+    DrainMiddleware middleware;
+    middleware.tracker = std::make_shared<drain::RequestTracker>();
+    crow::request request;
+    crow::response response;
+    DrainMiddleware::context context;
+
+    middleware.before_handle(request, response, context);
+    EXPECT_EQ(1, middleware.tracker->InFlight());
+    middleware.after_handle(request, response, context);
+    EXPECT_EQ(0, middleware.tracker->InFlight());
+    EXPECT_TRUE(response.get_header_value("Connection").empty());
+}
+
+// Validar que al drenar se pide cerrar la conexion
+TEST(DrainTest, ClosesConnectionsWhileDraining) {
+    DrainMiddleware middleware;
+    middleware.tracker = std::make_shared<drain::RequestTracker>();
+    middleware.monitor = std::make_shared<health::HealthMonitor>(std::vector<health::Check>{}, milliseconds(100));
+    middleware.monitor->BeginDraining();
+    crow::request request;
+    crow::response response;
+    DrainMiddleware::context context;
+
+    middleware.before_handle(request, response, context);
+    middleware.after_handle(request, response, context);
+
+    EXPECT_EQ("close", response.get_header_value("Connection"));
+}
+
+// Validar que la espera termina al salir la ultima solicitud o al vencer el plazo
+TEST(DrainTest, AwaitIdleUntilLastRequestOrDeadline) {
+    drain::RequestTracker tracker;
+    tracker.Enter();
+    EXPECT_FALSE(tracker.AwaitIdle(steady_clock::now() + milliseconds(10)));
+
+    std::jthread finisher([&] {
+        std::this_thread::sleep_for(milliseconds(10));
+        tracker.Leave();
+    });
+    EXPECT_TRUE(tracker.AwaitIdle(steady_clock::now() + std::chrono::seconds(5)));
+}
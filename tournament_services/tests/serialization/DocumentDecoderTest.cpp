@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Utilities.hpp"
+#include "serialization/DocumentDecoder.hpp"
+
+namespace {
+    // Corpus compartido: documentos tal como los guarda Postgres y variantes con escapes, duplicados y tipos raros
+    const std::vector<std::string> MATCH_CORPUS = {
+        R"({"name": "W0", "score": {"homeTeamScore": 0, "visitorTeamScore": 1}, "homeTeamId": "550e8400-e29b-41d4-a716-446655440000", "tournamentId": "660e8400-e29b-41d4-a716-446655440001", "visitorTeamId": "770e8400-e29b-41d4-a716-446655440002"})",
+        R"({"name":"L29","tournamentId":"660e8400-e29b-41d4-a716-446655440001","score":{"homeTeamScore":0,"visitorTeamScore":0}})",
+        R"({})",
+        R"(  { "name" : "F1" , "extra" : [1, 2.5e3, {"a": null}, true, false, "x"] }  )",
+        R"({"name":"Wé😀\n\"quoted\"\\","score":{"homeTeamScore":-3}})",
+        R"({"name":"W1","name":"W2","score":{"homeTeamScore":4},"score":{"visitorTeamScore":2}})",
+        R"({"score":{"homeTeamScore":1.5,"visitorTeamScore":2}})",
+        R"({"score":{"homeTeamScore":true}})",
+        R"({"score":{"homeTeamScore":4294967296}})",
+        R"({"score":5})",
+        R"({"name":null})",
+        R"({"name":"W0",})",
+        R"({"name":"W0"} trailing)",
+        R"([])",
+    };
+
+    const std::vector<std::string> GROUP_CORPUS = {
+        R"({"name": "Group A", "teams": [{"id": "550e8400-e29b-41d4-a716-446655440000", "name": "Team 1"}, {"id": "550e8400-e29b-41d4-a716-446655440001", "name": "Team 2"}], "tournamentId": "660e8400-e29b-41d4-a716-446655440001"})",
+        R"({"name":"Empty","teams":[]})",
+        R"({"name":"No teams key"})",
+        R"({"name":"Teams not array","teams":{"id":"x"}})",
+        R"({"name":"Partial teams","teams":[{"id":"only-id"},{"name":"only name"},{}]})",
+        R"({"name":"Odd teams","teams":[1,"x",null]})",
+        R"({"name":"Dup","teams":[{"id":"a"}],"teams":[{"id":"b"},{"id":"c"}]})",
+        R"({"name":5})",
+    };
+
+    const std::vector<std::string> TOURNAMENT_CORPUS = {
+        R"({"name": "Copa", "format": {"type": "DOUBLE_ELIMINATION", "numberOfGroups": 1, "maxTeamsPerGroup": 32}})",
+        R"({"name":"No format"})",
+        R"({"name":"Partial","format":{"maxTeamsPerGroup":8}})",
+        R"({"name":"Unknown type","format":{"type":"ROUND_ROBIN"}})",
+        R"({"name":"Bad type","format":{"type":1}})",
+        R"({"name":"Format not object","format":[]})",
+        R"({"id":"abc","name":"With id"})",
+    };
+
+    const std::vector<std::string> TEAM_CORPUS = {
+        R"({"name": "Team 1"})",
+        R"({"id":"550e8400-e29b-41d4-a716-446655440000","name":"Team \t tab"})",
+        R"({"id":"550e8400-e29b-41d4-a716-446655440000"})",
+        R"({"name":["array"]})",
+    };
+
+    template<typename T>
+    std::optional<nlohmann::json> DecodeWithNlohmann(const std::string& document) {
+        try {
+            T entity = nlohmann::json::parse(document).get<T>();
+            return nlohmann::json(entity);
+        } catch (const nlohmann::json::exception&) {
+            return std::nullopt;
+        }
+    }
+
+    template<typename T>
+    std::optional<nlohmann::json> DecodeWithParseDocument(const std::string& document) {
+        try {
+            return nlohmann::json(serialization::ParseDocument<T>(document));
+        } catch (const nlohmann::json::exception&) {
+            return std::nullopt;
+        }
+    }
+
+    template<typename T>
+    int CheckCorpus(const std::vector<std::string>& corpus) {
+        int fastDecoded = 0;
+        for (const auto& document : corpus) {
+            const auto expected = DecodeWithNlohmann<T>(document);
+
+            T entity;
+            if (serialization::DecodeDocument(document, entity)) {
+                ++fastDecoded;
+                EXPECT_TRUE(expected.has_value()) << document;
+                if (expected) {
+                    EXPECT_EQ(*expected, nlohmann::json(entity)) << document;
+                }
+            }
+            EXPECT_EQ(expected, DecodeWithParseDocument<T>(document)) << document;
+        }
+        return fastDecoded;
+    }
+}
+
+// Validar que la ruta rapida produce exactamente lo mismo que nlohmann para el corpus de matches
+TEST(DocumentDecoderTest, Match_SameAsNlohmann) {
+    EXPECT_GE(CheckCorpus<domain::Match>(MATCH_CORPUS), 6);
+}
+
+// Validar el corpus de grupos
+TEST(DocumentDecoderTest, Group_SameAsNlohmann) {
+    EXPECT_GE(CheckCorpus<domain::Group>(GROUP_CORPUS), 5);
+}
+
+// Validar el corpus de torneos
+TEST(DocumentDecoderTest, Tournament_SameAsNlohmann) {
+    EXPECT_GE(CheckCorpus<domain::Tournament>(TOURNAMENT_CORPUS), 5);
+}
+
+// Validar el corpus de equipos
+TEST(DocumentDecoderTest, Team_SameAsNlohmann) {
+    EXPECT_GE(CheckCorpus<domain::Team>(TEAM_CORPUS), 2);
+}
+
+// Validar decodificacion de escapes y pares sustitutos
+TEST(DocumentDecoderTest, Match_DecodesEscapes) {
+    domain::Match match;
+    ASSERT_TRUE(serialization::DecodeDocument(MATCH_CORPUS[4], match));
+    EXPECT_EQ("W\xc3\xa9\xf0\x9f\x98\x80\n\"quoted\"\\", match.Name());
+    EXPECT_EQ(-3, match.MatchScore().homeTeamScore);
+}
+
+// Validar que valor y shared_ptr se serializan igual (misma tabla de campos) y que un nulo produce null
+TEST(DocumentDecoderTest, SharedPtrAndValue_SameJson) {
+    domain::Team team{"", "Team without id"};
+    EXPECT_EQ(nlohmann::json(team), nlohmann::json(std::make_shared<domain::Team>(team)));
+    EXPECT_TRUE(nlohmann::json(std::shared_ptr<domain::Team>()).is_null());
+
+    domain::Tournament tournament{"Copa"};
+    EXPECT_EQ(nlohmann::json(tournament), nlohmann::json(std::make_shared<domain::Tournament>(tournament)));
+}
+
+// Validar que un campo requerido ausente lanza la misma excepcion que nlohmann
+TEST(DocumentDecoderTest, MissingRequiredField_Throws) {
+    EXPECT_THROW(nlohmann::json::parse(R"({"id":"x"})").get<domain::Team>(), nlohmann::json::out_of_range);
+    EXPECT_THROW(nlohmann::json::parse(R"({"format":{}})").get<domain::Tournament>(), nlohmann::json::out_of_range);
+    EXPECT_NO_THROW(nlohmann::json::parse(R"([{"id":"x"}])").get<std::vector<domain::Team>>());
+}
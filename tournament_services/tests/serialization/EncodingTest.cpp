@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Utilities.hpp"
+#include "serialization/Encoding.hpp"
+
+namespace {
+    std::vector<std::uint8_t> Bytes(const std::string& encoded) {
+        return {encoded.begin(), encoded.end()};
+    }
+
+    std::vector<std::shared_ptr<domain::Match>> MakeMatches(int count) {
+        std::vector<std::shared_ptr<domain::Match>> matches;
+        for (int i = 0; i < count; ++i) {
+            auto match = std::make_shared<domain::Match>();
+            match->Id() = "660e8400-e29b-41d4-a716-4466554400" + std::to_string(10 + i);
+            match->Name() = "W" + std::to_string(i);
+            match->TournamentId() = "550e8400-e29b-41d4-a716-446655440000";
+            match->HomeTeamId() = i % 2 ? "home" : std::string(300, 'h');
+            match->MatchScore().homeTeamScore = i * 97 - 4000;
+            match->MatchScore().visitorTeamScore = i * 70001;
+            matches.push_back(match);
+        }
+        return matches;
+    }
+
+    nlohmann::json ToJson(const std::vector<std::shared_ptr<domain::Match>>& matches) {
+        return matches;
+    }
+}
+
+// Validar que MessagePack y CBOR coinciden byte a byte con nlohmann, incluyendo encabezados anchos (> 23 elementos)
+TEST(EncodingTest, Matches_SameBytesAsNlohmann) {
+    for (int count : {0, 1, 15, 16, 23, 24, 300}) {
+        const auto matches = MakeMatches(count);
+        const auto json = ToJson(matches);
+
+        std::string msgpack;
+        serialization::Encode(msgpack, serialization::Encoding::MSGPACK, matches, 192);
+        EXPECT_EQ(nlohmann::json::to_msgpack(json), Bytes(msgpack)) << count;
+
+        std::string cbor;
+        serialization::Encode(cbor, serialization::Encoding::CBOR, matches, 192);
+        EXPECT_EQ(nlohmann::json::to_cbor(json), Bytes(cbor)) << count;
+
+        std::string text;
+        serialization::Encode(text, serialization::Encoding::JSON, matches, 192);
+        EXPECT_EQ(json.dump(), text) << count;
+    }
+}
+
+// Validar grupos con equipos anidados en ambos formatos binarios
+TEST(EncodingTest, Group_RoundTrip) {
+    domain::Group group("Group A", "770e8400-e29b-41d4-a716-446655440002");
+    group.TournamentId() = "550e8400-e29b-41d4-a716-446655440000";
+    for (int i = 0; i < 20; ++i) {
+        group.Teams().push_back(domain::Team{"team-" + std::to_string(i), "Team " + std::to_string(i)});
+    }
+    const nlohmann::json json = group;
+
+    std::string msgpack;
+    serialization::Encode(msgpack, serialization::Encoding::MSGPACK, group);
+    EXPECT_EQ(json, nlohmann::json::from_msgpack(msgpack));
+
+    std::string cbor;
+    serialization::Encode(cbor, serialization::Encoding::CBOR, group);
+    EXPECT_EQ(json, nlohmann::json::from_cbor(cbor));
+}
+
+// Validar la negociacion de contenido con Accept y Content-Type
+TEST(EncodingTest, Negotiation) {
+    using serialization::Encoding;
+    EXPECT_EQ(Encoding::JSON, serialization::NegotiateEncoding(""));
+    EXPECT_EQ(Encoding::JSON, serialization::NegotiateEncoding("text/html,application/xhtml+xml,*/*;q=0.8"));
+    EXPECT_EQ(Encoding::MSGPACK, serialization::NegotiateEncoding("application/msgpack"));
+    EXPECT_EQ(Encoding::MSGPACK, serialization::NegotiateEncoding("application/json;q=0.5, application/x-msgpack"));
+    EXPECT_EQ(Encoding::CBOR, serialization::NegotiateEncoding("Application/CBOR; q=0.9, application/json; q=0.2"));
+    EXPECT_EQ(Encoding::JSON, serialization::NegotiateEncoding("application/cbor;q=0, application/json"));
+
+    EXPECT_EQ(Encoding::JSON, serialization::EncodingOf(""));
+    EXPECT_EQ(Encoding::JSON, serialization::EncodingOf("application/json; charset=utf-8"));
+    EXPECT_EQ(Encoding::CBOR, serialization::EncodingOf("application/cbor"));
+}
+
+// Validar la transcodificacion de cuerpos binarios a JSON
+TEST(EncodingTest, TranscodeToJson) {
+    const nlohmann::json body = {{"score", {{"homeTeamScore", 1}, {"visitorTeamScore", 2}}}};
+    const auto msgpack = nlohmann::json::to_msgpack(body);
+    const auto json = serialization::TranscodeToJson(std::string(msgpack.begin(), msgpack.end()), serialization::Encoding::MSGPACK);
+    ASSERT_TRUE(json.has_value());
+    EXPECT_EQ(body.dump(), *json);
+
+    EXPECT_FALSE(serialization::TranscodeToJson("\xC1", serialization::Encoding::MSGPACK).has_value());
+    EXPECT_FALSE(serialization::TranscodeToJson("\x62\xC0\xAF", serialization::Encoding::CBOR).has_value());
+}
+
+// Validar el parseo de ?fields=: claves de la tabla, espacios ignorados, claves desconocidas o lista vacia rechazadas
+TEST(EncodingTest, FieldSet_Parse) {
+    using MatchFields = serialization::FieldSet<domain::Match>;
+    const auto fields = MatchFields::Parse(" score ,id,");
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_FALSE(fields->IsAll());
+    EXPECT_EQ(2, fields->Size());
+    EXPECT_TRUE(fields->Contains("id"));
+    EXPECT_FALSE(fields->Contains("name"));
+    EXPECT_EQ("{homeTeamId,name,tournamentId,visitorTeamId}", fields->ExcludedKeysArray());
+    EXPECT_EQ(MatchFields::Parse("id,score"), fields);
+
+    EXPECT_TRUE(MatchFields::Parse("visitorTeamId,tournamentId,score,name,id,homeTeamId")->IsAll());
+    EXPECT_EQ("password", MatchFields::Parse("id,password").error());
+    EXPECT_EQ("", MatchFields::Parse(" , ").error());
+}
+
+// Validar que la lista parcial solo lleva los campos pedidos y coincide con nlohmann sobre esos campos
+TEST(EncodingTest, Matches_SparseFieldset) {
+    const auto matches = MakeMatches(30);
+    std::vector<domain::Match> values;
+    for (const auto& match : matches) {
+        values.push_back(*match);
+    }
+    const auto fields = serialization::FieldSet<domain::Match>::Parse("id,score");
+    ASSERT_TRUE(fields.has_value());
+
+    nlohmann::json expected = nlohmann::json::array();
+    for (const auto& match : matches) {
+        expected.push_back({{"id", match->Id()}, {"score", match->MatchScore()}});
+    }
+    for (auto encoding : {serialization::Encoding::JSON, serialization::Encoding::MSGPACK, serialization::Encoding::CBOR}) {
+        std::string out;
+        serialization::Encode(out, encoding, values, 192, *fields);
+        const auto decoded = encoding == serialization::Encoding::JSON ? nlohmann::json::parse(out)
+            : encoding == serialization::Encoding::MSGPACK ? nlohmann::json::from_msgpack(out)
+            : nlohmann::json::from_cbor(out);
+        EXPECT_EQ(expected, decoded);
+    }
+
+    std::string full;
+    std::string all;
+    serialization::Encode(full, serialization::Encoding::JSON, values, 192);
+    serialization::Encode(all, serialization::Encoding::JSON, values, 192, serialization::FieldSet<domain::Match>::All());
+    EXPECT_EQ(full, all);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Utilities.hpp"
+#include "serialization/Encoding.hpp"
+
+namespace {
+    template<typename T>
+    std::string WriteWithWriter(const std::vector<std::shared_ptr<T>>& entities) {
+        std::string out;
+        serialization::WriteList(out, entities);
+        return out;
+    }
+
+    template<typename T>
+    std::string WriteWithNlohmann(const std::vector<std::shared_ptr<T>>& entities) {
+        nlohmann::json arr = nlohmann::json::array();
+        for (const auto& entity : entities) {
+            if (entity) {
+                arr.push_back(*entity);
+            } else {
+                arr.push_back(nullptr);
+            }
+        }
+        return arr.dump();
+    }
+}
+
+// Validar que la lista de matches es identica byte a byte a la de nlohmann
+TEST(JsonWriterTest, Matches_SameAsNlohmann) {
+    auto full = std::make_shared<domain::Match>();
+    full->Id() = "660e8400-e29b-41d4-a716-446655440001";
+    full->Name() = "W0";
+    full->TournamentId() = "550e8400-e29b-41d4-a716-446655440000";
+    full->HomeTeamId() = "team-home";
+    full->VisitorTeamId() = "team-visitor";
+    full->MatchScore().homeTeamScore = 3;
+    full->MatchScore().visitorTeamScore = -1;
+
+    auto partial = std::make_shared<domain::Match>();
+    partial->Name() = "L\"29\"\\\n\t\x01\x1f/é";
+
+    std::vector<std::shared_ptr<domain::Match>> matches = {full, partial, nullptr, std::make_shared<domain::Match>()};
+    EXPECT_EQ(WriteWithNlohmann(matches), WriteWithWriter(matches));
+    EXPECT_EQ("[]", WriteWithWriter(std::vector<std::shared_ptr<domain::Match>>{}));
+}
+
+// Validar equipos, grupos y torneos
+TEST(JsonWriterTest, TeamsGroupsTournaments_SameAsNlohmann) {
+    std::vector<std::shared_ptr<domain::Team>> teams = {
+        std::make_shared<domain::Team>(domain::Team{"550e8400-e29b-41d4-a716-446655440000", "Team 1"}),
+        std::make_shared<domain::Team>(domain::Team{"", ""}),
+    };
+    EXPECT_EQ(WriteWithNlohmann(teams), WriteWithWriter(teams));
+
+    auto group = std::make_shared<domain::Group>("Group A", "770e8400-e29b-41d4-a716-446655440002");
+    group->TournamentId() = "550e8400-e29b-41d4-a716-446655440000";
+    group->Teams().push_back(*teams[0]);
+    group->Teams().push_back(domain::Team{"id-2", "Team \"2\""});
+    auto emptyGroup = std::make_shared<domain::Group>("Empty");
+    std::vector<std::shared_ptr<domain::Group>> groups = {group, emptyGroup};
+    nlohmann::json groupsJson = groups;
+    EXPECT_EQ(groupsJson.dump(), WriteWithWriter(groups));
+
+    auto tournament = std::make_shared<domain::Tournament>("Copa", domain::TournamentFormat(2, 32));
+    tournament->Id() = "550e8400-e29b-41d4-a716-446655440000";
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments = {tournament, std::make_shared<domain::Tournament>("Sin id")};
+    EXPECT_EQ(WriteWithNlohmann(tournaments), WriteWithWriter(tournaments));
+}
+
+// Validar anidamiento y separadores del escritor
+TEST(JsonWriterTest, Writer_Nesting) {
+    std::string out = "prefix:";
+    serialization::JsonWriter writer(out);
+    writer.BeginObject()
+        .Key("a").BeginArray().Int(1).Int(-20).BeginObject().EndObject().BeginArray().EndArray().EndArray()
+        .Key("b").Bool(true)
+        .Key("c").Null()
+        .Key("d").BeginObject().Key("e").String("x").EndObject()
+        .EndObject();
+    EXPECT_EQ(R"(prefix:{"a":[1,-20,{},[]],"b":true,"c":null,"d":{"e":"x"}})", out);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+#include "domain/Match.hpp"
+#include "serialization/RequestSchema.hpp"
+
+namespace {
+    using serialization::FieldRule;
+    using serialization::JsonReader;
+    using serialization::Presence;
+    using serialization::RequestError;
+
+    constexpr FieldRule<domain::Score> SCORE_SCHEMA[] = {
+        {"homeTeamScore", Presence::REQUIRED,
+            [](JsonReader& r, domain::Score& s, RequestError& e) { return serialization::ReadIntField(r, s.homeTeamScore, e); },
+            "homeTeamScore must be an integer"},
+        {"visitorTeamScore", Presence::OPTIONAL,
+            [](JsonReader& r, domain::Score& s, RequestError& e) { return serialization::ReadIntField(r, s.visitorTeamScore, e); },
+            "visitorTeamScore must be an integer"},
+    };
+
+    constexpr FieldRule<domain::Match> MATCH_SCHEMA[] = {
+        {"name", Presence::REQUIRED,
+            [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::ReadStringField(r, m.Name(), e); },
+            "name must be a string"},
+        {"id", Presence::FORBIDDEN, nullptr, "id is not editable"},
+        {"score", Presence::OPTIONAL,
+            [](JsonReader& r, domain::Match& m, RequestError& e) { return serialization::DecodeObject<domain::Score>(r, m.MatchScore(), SCORE_SCHEMA, e); },
+            "score must be an object"},
+    };
+
+    RequestError DecodeError(std::string_view body) {
+        auto result = serialization::DecodeRequest<domain::Match>(body, MATCH_SCHEMA);
+        EXPECT_FALSE(result.has_value()) << body;
+        return result ? RequestError{} : result.error();
+    }
+}
+
+// Validar decodificacion en una sola pasada, ignorando miembros desconocidos
+TEST(RequestSchemaTest, Decode_Ok) {
+    auto match = serialization::DecodeRequest<domain::Match>(
+        R"( {"extra": {"a": [1, 2.5, null]}, "name": "Wé1", "score": {"homeTeamScore": 2, "visitorTeamScore": 0}} )",
+        MATCH_SCHEMA);
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ("W\xC3\xA9" "1", match->Name());
+    EXPECT_EQ(2, match->MatchScore().homeTeamScore);
+    EXPECT_EQ(0, match->MatchScore().visitorTeamScore);
+}
+
+// Validar errores estructurados: campo y mensaje
+TEST(RequestSchemaTest, Decode_StructuredErrors) {
+    auto error = DecodeError(R"({"score": {"homeTeamScore": 1}})");
+    EXPECT_EQ("name", error.field);
+
+    error = DecodeError(R"({"name": 5})");
+    EXPECT_EQ("name", error.field);
+    EXPECT_EQ("name must be a string", error.message);
+
+    error = DecodeError(R"({"name": "x", "id": "y"})");
+    EXPECT_EQ("id", error.field);
+    EXPECT_EQ("id is not editable", error.message);
+
+    error = DecodeError(R"({"name": "x", "score": {"visitorTeamScore": 1}})");
+    EXPECT_EQ("score.homeTeamScore", error.field);
+
+    error = DecodeError(R"({"name": "x", "score": {"homeTeamScore": 1.5}})");
+    EXPECT_EQ("score.homeTeamScore", error.field);
+    EXPECT_EQ("homeTeamScore must be an integer", error.message);
+
+    error = DecodeError(R"({"name": "x", "score": []})");
+    EXPECT_EQ("score", error.field);
+    EXPECT_EQ("score must be an object", error.message);
+
+    error = DecodeError(R"(["name"])");
+    EXPECT_EQ("Request body must be a JSON object", error.message);
+}
+
+// Validar que JSON mal formado o UTF-8 invalido se reporta como formato invalido
+TEST(RequestSchemaTest, Decode_InvalidJson) {
+    for (std::string_view body : {"", "{invalid json", R"({"name": "x")", R"({"name": "x"} trailing)",
+                                  R"({"name": "x", "score": {"homeTeamScore": })", "{\"name\": \"\xC0\xAF\"}"}) {
+        auto error = DecodeError(body);
+        EXPECT_EQ(serialization::INVALID_JSON, error.message) << body;
+        EXPECT_TRUE(error.field.empty()) << body;
+    }
+}
+
+// Validar arreglos de objetos con la ruta del elemento en el error
+TEST(RequestSchemaTest, DecodeArray_ReportsIndex) {
+    auto matches = serialization::DecodeArrayRequest<domain::Match>(R"([{"name": "a"}, {"name": "b"}])", MATCH_SCHEMA);
+    ASSERT_TRUE(matches.has_value());
+    ASSERT_EQ(2u, matches->size());
+    EXPECT_EQ("b", (*matches)[1].Name());
+
+    auto failed = serialization::DecodeArrayRequest<domain::Match>(R"([{"name": "a"}, {"name": "b", "score": {"homeTeamScore": "1"}}])", MATCH_SCHEMA);
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_EQ("[1].score.homeTeamScore", failed.error().field);
+
+    failed = serialization::DecodeArrayRequest<domain::Match>(R"([{"name": "a"}, 3])", MATCH_SCHEMA);
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_EQ("[1]", failed.error().field);
+}
@@ -0,0 +1,65 @@
+#include "support/AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local std::size_t activeScopes = 0;
+    thread_local test_support::AllocationStats counters;
+
+    void* Allocate(std::size_t size, std::size_t alignment) {
+        if (activeScopes > 0) {
+            ++counters.allocations;
+            counters.bytes += size;
+        }
+        if (size == 0) {
+            size = 1;
+        }
+        void* memory = alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+            ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+            : std::malloc(size);
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        return memory;
+    }
+}
+
+namespace test_support {
+    AllocationScope::AllocationScope() : start(counters) {
+        ++activeScopes;
+    }
+
+    AllocationScope::~AllocationScope() {
+        --activeScopes;
+    }
+
+    std::size_t AllocationScope::Allocations() const {
+        return counters.allocations - start.allocations;
+    }
+
+    std::size_t AllocationScope::Bytes() const {
+        return counters.bytes - start.bytes;
+    }
+}
+
+void* operator new(std::size_t size) { return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return Allocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return Allocate(size, static_cast<std::size_t>(alignment)); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
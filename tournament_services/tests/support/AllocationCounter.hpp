@@ -0,0 +1,34 @@
+#ifndef TESTS_ALLOCATION_COUNTER_HPP
+#define TESTS_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+// Counts global operator new calls made by the current thread while a scope is alive.
+// The replacement operators live in AllocationCounter.cpp and are linked into the test runner.
+namespace test_support {
+    struct AllocationStats {
+        std::size_t allocations = 0;
+        std::size_t bytes = 0;
+    };
+
+    class AllocationScope {
+        AllocationStats start;
+    public:
+        AllocationScope();
+        ~AllocationScope();
+        AllocationScope(const AllocationScope&) = delete;
+        AllocationScope& operator=(const AllocationScope&) = delete;
+
+        [[nodiscard]] std::size_t Allocations() const;
+        [[nodiscard]] std::size_t Bytes() const;
+    };
+
+    template<typename Operation>
+    AllocationStats CountAllocations(Operation&& operation) {
+        AllocationScope scope;
+        operation();
+        return {scope.Allocations(), scope.Bytes()};
+    }
+}
+
+#endif //TESTS_ALLOCATION_COUNTER_HPP
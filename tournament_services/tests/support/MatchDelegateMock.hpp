@@ -0,0 +1,32 @@
+#ifndef TESTS_MATCH_DELEGATE_MOCK_HPP
+#define TESTS_MATCH_DELEGATE_MOCK_HPP
+
+#include <gmock/gmock.h>
+#include <expected>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "delegate/IMatchDelegate.hpp"
+
+// The one IMatchDelegate mock, shared by every controller test that drives matches.
+namespace test_support {
+    class MatchDelegateMock : public IMatchDelegate {
+    public:
+        MOCK_METHOD((std::expected<std::shared_ptr<domain::Match>, Error>), GetMatch,
+                    (std::string_view tournamentId, std::string_view matchId), (override));
+        MOCK_METHOD((std::expected<std::pmr::vector<domain::Match>, Error>), GetMatches,
+                    (std::string_view tournamentId, const serialization::FieldSet<domain::Match>& fields), (override));
+        MOCK_METHOD((std::expected<std::string, Error>), GetMatchesJson,
+                    (std::string_view tournamentId, const serialization::FieldSet<domain::Match>& fields), (override));
+        MOCK_METHOD((std::expected<std::string, Error>), GetMatchesVersion, (std::string_view tournamentId), (override));
+        MOCK_METHOD((std::expected<domain::Bracket, Error>), GetBracket, (std::string_view tournamentId), (override));
+        MOCK_METHOD((std::vector<std::expected<std::string, Error>>), UpdateMatchScores,
+                    (const std::vector<domain::Match>&), (override));
+        MOCK_METHOD((std::expected<std::string, Error>), UpdateMatchScore, (const domain::Match&), (override));
+    };
+}
+
+#endif //TESTS_MATCH_DELEGATE_MOCK_HPP